@@ -0,0 +1,124 @@
+#include "AdjacencyCount.h"
+
+#if defined(__AVX2__)
+#define ADJACENCY_COUNT_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ADJACENCY_COUNT_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    // THE EIGHT NEIGHBOR BITS OF 64 TILES ARE SUMMED WITH A BIT-SLICED ADDER TREE: THREE FULL ADDERS AND A HALF
+    // ADDER REDUCE THEM TO ONE ONES-BIT AND FOUR TWOS-BITS, WHICH REDUCE TO ONE TWOS-BIT AND TWO FOURS-BITS.
+    // EVERY VARIANT BELOW RUNS THE SAME TREE, ONLY ON WIDER REGISTERS
+    void countWord(const uint64_t* north, const uint64_t* center, const uint64_t* south, int k, uint64_t* out)
+    {
+        const uint64_t a0 = (north[k] << 1) | (north[k - 1] >> 63);
+        const uint64_t a1 = north[k];
+        const uint64_t a2 = (north[k] >> 1) | (north[k + 1] << 63);
+        const uint64_t a3 = (center[k] << 1) | (center[k - 1] >> 63);
+        const uint64_t a4 = (center[k] >> 1) | (center[k + 1] << 63);
+        const uint64_t a5 = (south[k] << 1) | (south[k - 1] >> 63);
+        const uint64_t a6 = south[k];
+        const uint64_t a7 = (south[k] >> 1) | (south[k + 1] << 63);
+
+        const uint64_t s0 = a0 ^ a1 ^ a2, c0 = (a0 & a1) | (a2 & (a0 ^ a1));
+        const uint64_t s1 = a3 ^ a4 ^ a5, c1 = (a3 & a4) | (a5 & (a3 ^ a4));
+        const uint64_t s2 = a6 ^ a7, c2 = a6 & a7;
+        const uint64_t ones = s0 ^ s1 ^ s2, c3 = (s0 & s1) | (s2 & (s0 ^ s1));
+        const uint64_t t0 = c0 ^ c1 ^ c2, d0 = (c0 & c1) | (c2 & (c0 ^ c1));
+        const uint64_t twos = t0 ^ c3, d1 = t0 & c3;
+
+        out[0] = ones;
+        out[1] = twos;
+        out[2] = d0 ^ d1;
+        out[3] = d0 & d1;
+    }
+
+#if defined(ADJACENCY_COUNT_AVX2)
+    typedef __m256i Lanes;
+    constexpr int LANE_WORDS = 4;
+
+    inline Lanes load(const uint64_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    inline void store(uint64_t* p, Lanes v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    inline Lanes bitAnd(Lanes a, Lanes b) { return _mm256_and_si256(a, b); }
+    inline Lanes bitOr(Lanes a, Lanes b) { return _mm256_or_si256(a, b); }
+    inline Lanes bitXor(Lanes a, Lanes b) { return _mm256_xor_si256(a, b); }
+    inline Lanes shiftLeft(Lanes a, int n) { return _mm256_slli_epi64(a, n); }
+    inline Lanes shiftRight(Lanes a, int n) { return _mm256_srli_epi64(a, n); }
+#elif defined(ADJACENCY_COUNT_SSE2)
+    typedef __m128i Lanes;
+    constexpr int LANE_WORDS = 2;
+
+    inline Lanes load(const uint64_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    inline void store(uint64_t* p, Lanes v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+    inline Lanes bitAnd(Lanes a, Lanes b) { return _mm_and_si128(a, b); }
+    inline Lanes bitOr(Lanes a, Lanes b) { return _mm_or_si128(a, b); }
+    inline Lanes bitXor(Lanes a, Lanes b) { return _mm_xor_si128(a, b); }
+    inline Lanes shiftLeft(Lanes a, int n) { return _mm_slli_epi64(a, n); }
+    inline Lanes shiftRight(Lanes a, int n) { return _mm_srli_epi64(a, n); }
+#endif
+
+#if defined(ADJACENCY_COUNT_AVX2) || defined(ADJACENCY_COUNT_SSE2)
+    // SAME AS countWord FOR LANE_WORDS CONSECUTIVE WORDS. THE CARRY BITS ACROSS WORD BOUNDARIES COME FROM
+    // UNALIGNED LOADS ONE WORD TO THE LEFT AND RIGHT, WHICH THE GUARD WORDS KEEP IN BOUNDS
+    void countLanes(const uint64_t* north, const uint64_t* center, const uint64_t* south, int k,
+        uint64_t* const* out)
+    {
+        const Lanes n = load(north + k), c = load(center + k), s = load(south + k);
+        const Lanes a0 = bitOr(shiftLeft(n, 1), shiftRight(load(north + k - 1), 63));
+        const Lanes a1 = n;
+        const Lanes a2 = bitOr(shiftRight(n, 1), shiftLeft(load(north + k + 1), 63));
+        const Lanes a3 = bitOr(shiftLeft(c, 1), shiftRight(load(center + k - 1), 63));
+        const Lanes a4 = bitOr(shiftRight(c, 1), shiftLeft(load(center + k + 1), 63));
+        const Lanes a5 = bitOr(shiftLeft(s, 1), shiftRight(load(south + k - 1), 63));
+        const Lanes a6 = s;
+        const Lanes a7 = bitOr(shiftRight(s, 1), shiftLeft(load(south + k + 1), 63));
+
+        const Lanes x01 = bitXor(a0, a1), x34 = bitXor(a3, a4);
+        const Lanes s0 = bitXor(x01, a2), c0 = bitOr(bitAnd(a0, a1), bitAnd(a2, x01));
+        const Lanes s1 = bitXor(x34, a5), c1 = bitOr(bitAnd(a3, a4), bitAnd(a5, x34));
+        const Lanes s2 = bitXor(a6, a7), c2 = bitAnd(a6, a7);
+        const Lanes xs = bitXor(s0, s1), xc = bitXor(c0, c1);
+        const Lanes ones = bitXor(xs, s2), c3 = bitOr(bitAnd(s0, s1), bitAnd(s2, xs));
+        const Lanes t0 = bitXor(xc, c2), d0 = bitOr(bitAnd(c0, c1), bitAnd(c2, xc));
+        const Lanes twos = bitXor(t0, c3), d1 = bitAnd(t0, c3);
+
+        store(out[0] + k, ones);
+        store(out[1] + k, twos);
+        store(out[2] + k, bitXor(d0, d1));
+        store(out[3] + k, bitAnd(d0, d1));
+    }
+#endif
+}
+
+void countAdjacentMines(const BitPlane& mines, BitPlane (&counts)[ADJACENCY_COUNT_BITS])
+{
+    const int wordsPerRow = mines.getWordsPerRow();
+    const int height = mines.getHeight();
+    for (int y = 0; y < height; ++y)
+    {
+        const uint64_t* north = mines.row(y - 1);
+        const uint64_t* center = mines.row(y);
+        const uint64_t* south = mines.row(y + 1);
+        uint64_t* const out[ADJACENCY_COUNT_BITS] = { counts[0].row(y), counts[1].row(y), counts[2].row(y), counts[3].row(y) };
+        int k = 0;
+#if defined(ADJACENCY_COUNT_AVX2) || defined(ADJACENCY_COUNT_SSE2)
+        for (; k + LANE_WORDS <= wordsPerRow; k += LANE_WORDS)
+        {
+            countLanes(north, center, south, k, out);
+        }
+#endif
+        for (; k < wordsPerRow; ++k)
+        {
+            uint64_t words[ADJACENCY_COUNT_BITS];
+            countWord(north, center, south, k, words);
+            for (int i = 0; i < ADJACENCY_COUNT_BITS; ++i)
+            {
+                out[i][k] = words[i];
+            }
+        }
+    }
+}
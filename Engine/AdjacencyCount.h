@@ -0,0 +1,9 @@
+#pragma once
+#include "BitPlane.h"
+
+// NUMBER OF BITS NEEDED FOR AN ADJACENT MINE COUNT (0 - 8)
+static constexpr int ADJACENCY_COUNT_BITS = 4;
+
+// WRITES THE NUMBER OF SET NEIGHBORS OF EVERY TILE OF mines INTO FOUR BIT-SLICED PLANES (BIT i OF THE
+// COUNT GOES TO counts[i]). USES AVX2 OR SSE2 WHEN THE BUILD ENABLES THEM AND PLAIN 64-BIT WORDS OTHERWISE
+void countAdjacentMines(const BitPlane& mines, BitPlane (&counts)[ADJACENCY_COUNT_BITS]);
@@ -0,0 +1,193 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+inline int popCount(uint64_t word)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+	return int(__popcnt64(word));
+#elif defined(_MSC_VER)
+	return int(__popcnt(unsigned(word)) + __popcnt(unsigned(word >> 32)));
+#else
+	return __builtin_popcountll(word);
+#endif
+}
+
+// INDEX OF THE LOWEST SET BIT, word MUST NOT BE ZERO
+inline int countTrailingZeros(uint64_t word)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanForward64(&index, word);
+	return int(index);
+#elif defined(_MSC_VER)
+	unsigned long index;
+	if (_BitScanForward(&index, unsigned long(word)))
+	{
+		return int(index);
+	}
+	_BitScanForward(&index, unsigned long(word >> 32));
+	return int(index) + 32;
+#else
+	return __builtin_ctzll(word);
+#endif
+}
+
+// EXTEND EVERY SEED BIT ALONG ITS RUN OF SET BITS IN mask, TOWARDS HIGHER / LOWER COLUMNS
+inline uint64_t fillUp(uint64_t seeds, uint64_t mask)
+{
+	seeds &= mask;
+	seeds |= mask & (seeds << 1);
+	mask &= mask << 1;
+	seeds |= mask & (seeds << 2);
+	mask &= mask << 2;
+	seeds |= mask & (seeds << 4);
+	mask &= mask << 4;
+	seeds |= mask & (seeds << 8);
+	mask &= mask << 8;
+	seeds |= mask & (seeds << 16);
+	mask &= mask << 16;
+	seeds |= mask & (seeds << 32);
+	return seeds;
+}
+
+inline uint64_t fillDown(uint64_t seeds, uint64_t mask)
+{
+	seeds &= mask;
+	seeds |= mask & (seeds >> 1);
+	mask &= mask >> 1;
+	seeds |= mask & (seeds >> 2);
+	mask &= mask >> 2;
+	seeds |= mask & (seeds >> 4);
+	mask &= mask >> 4;
+	seeds |= mask & (seeds >> 8);
+	mask &= mask >> 8;
+	seeds |= mask & (seeds >> 16);
+	mask &= mask >> 16;
+	seeds |= mask & (seeds >> 32);
+	return seeds;
+}
+
+// ONE BIT PER TILE, PACKED 64 TILES TO A WORD (BIT i OF WORD k IS COLUMN 64k+i).
+// EVERY ROW HAS A ZERO GUARD WORD ON EACH SIDE AND THERE IS A ZERO GUARD ROW ABOVE AND BELOW,
+// SO NEIGHBOR LOOKUPS AT THE EDGES NEVER NEED A BOUNDS CHECK.
+// A PLANE EITHER OWNS ITS WORDS OR LIVES IN getWordCount() WORDS OF MEMORY OWNED BY SOMEONE ELSE (A POOL).
+// COPIES ALWAYS OWN THEIR WORDS, EXCEPT THAT ASSIGNING TO A PLANE OF THE SAME SIZE COPIES INTO ITS MEMORY
+class BitPlane
+{
+public:
+	BitPlane() = default;
+	BitPlane(int _width, int _height)
+		:width(_width), height(_height), wordsPerRow((_width + 63) / 64), stride(wordsPerRow + 2),
+		ownedWords(getWordCount(_width, _height), 0u), words(ownedWords.data())
+	{
+	}
+	// THE PLANE IS CLEARED, GUARDS INCLUDED
+	BitPlane(int _width, int _height, uint64_t* storage)
+		:width(_width), height(_height), wordsPerRow((_width + 63) / 64), stride(wordsPerRow + 2),
+		words(storage)
+	{
+		clear();
+	}
+	BitPlane(const BitPlane& other)
+		:width(other.width), height(other.height), wordsPerRow(other.wordsPerRow), stride(other.stride),
+		ownedWords(other.words, other.words + other.getWordCount()), words(ownedWords.data())
+	{
+	}
+	BitPlane(BitPlane&& other)
+		:width(other.width), height(other.height), wordsPerRow(other.wordsPerRow), stride(other.stride),
+		ownedWords(std::move(other.ownedWords)), words(other.words)
+	{
+		other.words = nullptr;
+	}
+	BitPlane& operator=(const BitPlane& other)
+	{
+		if (this != &other)
+		{
+			if (words != nullptr && width == other.width && height == other.height)
+			{
+				std::copy(other.words, other.words + other.getWordCount(), words);
+			}
+			else {
+				*this = BitPlane(other);
+			}
+		}
+		return *this;
+	}
+	BitPlane& operator=(BitPlane&& other)
+	{
+		if (this != &other)
+		{
+			width = other.width;
+			height = other.height;
+			wordsPerRow = other.wordsPerRow;
+			stride = other.stride;
+			ownedWords = std::move(other.ownedWords);
+			words = other.words;
+			other.words = nullptr;
+		}
+		return *this;
+	}
+	static size_t getWordCount(int width, int height)
+	{
+		return size_t((width + 63) / 64 + 2) * (height + 2);
+	}
+	bool get(int x, int y) const
+	{
+		return (row(y)[x >> 6] >> (x & 63)) & 1u;
+	}
+	void set(int x, int y)
+	{
+		row(y)[x >> 6] |= uint64_t(1) << (x & 63);
+	}
+	void reset(int x, int y)
+	{
+		row(y)[x >> 6] &= ~(uint64_t(1) << (x & 63));
+	}
+	void toggle(int x, int y)
+	{
+		row(y)[x >> 6] ^= uint64_t(1) << (x & 63);
+	}
+	// VALID FOR y IN [-1, height], WHERE -1 AND height ARE THE GUARD ROWS
+	uint64_t* row(int y)
+	{
+		return &words[size_t(y + 1) * stride + 1];
+	}
+	const uint64_t* row(int y) const
+	{
+		return &words[size_t(y + 1) * stride + 1];
+	}
+	// MASK OF THE BITS IN WORD k THAT LIE INSIDE THE PLANE
+	uint64_t getWordMask(int k) const
+	{
+		const int nBits = width - k * 64;
+		return nBits >= 64 ? ~uint64_t(0) : (uint64_t(1) << nBits) - 1u;
+	}
+	int getWordsPerRow() const
+	{
+		return wordsPerRow;
+	}
+	int getHeight() const
+	{
+		return height;
+	}
+	size_t getWordCount() const
+	{
+		return size_t(stride) * (height + 2);
+	}
+	void clear()
+	{
+		std::fill(words, words + getWordCount(), uint64_t(0));
+	}
+private:
+	int width = 0;
+	int height = 0;
+	int wordsPerRow = 0;
+	int stride = 0;
+	std::vector<uint64_t> ownedWords;
+	uint64_t* words = nullptr;
+};
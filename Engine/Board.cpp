@@ -0,0 +1,710 @@
+#include "Board.h"
+#include <assert.h>
+#include <algorithm>
+
+namespace
+{
+    // BITS OF WORD k FOR THE COLUMNS first TO last
+    uint64_t columnMask(int k, int first, int last)
+    {
+        const int low = std::max(first - k * 64, 0);
+        const int high = std::min(last - k * 64, 63);
+        if (low > high) return 0u;
+        const uint64_t upTo = high == 63 ? ~uint64_t(0) : (uint64_t(2) << high) - 1u;
+        return upTo & ~((uint64_t(1) << low) - 1u);
+    }
+}
+
+Board::Board(int _width, int _height, int _nMines, uint64_t _seed)
+    :width(_width), height(_height), nMines(_nMines), seed(_seed), isGenerated(false), nRevealedSafeTiles(0),
+    isMineTriggered(false), mines(_width, _height), revealed(_width, _height), flagged(_width, _height)
+{
+    assert(_width > 0 && _height > 0);
+    assert(_nMines > 0 && _nMines < (width * height));
+}
+
+Board::Board(int _width, int _height, int _nMines, uint64_t _seed, uint64_t* storage)
+    :width(_width), height(_height), nMines(_nMines), seed(_seed), isGenerated(false), nRevealedSafeTiles(0),
+    isMineTriggered(false), mines(_width, _height, storage),
+    revealed(_width, _height, storage + getPlaneStride(_width, _height)),
+    flagged(_width, _height, storage + 2 * getPlaneStride(_width, _height))
+{
+    assert(_width > 0 && _height > 0);
+    assert(_nMines > 0 && _nMines < (width * height));
+    assert(reinterpret_cast<uintptr_t>(storage) % (PLANE_ALIGNMENT_WORDS * sizeof(uint64_t)) == 0);
+    allocateScratch(storage);
+}
+
+void Board::restore(const uint64_t* mineRows, const uint64_t* revealedRows, const uint64_t* flaggedRows)
+{
+    const int wordsPerRow = mines.getWordsPerRow();
+    isGenerated = mineRows != nullptr;
+    nRevealedSafeTiles = 0;
+    isMineTriggered = false;
+    for (int y = 0; y < height; ++y)
+    {
+        const size_t rowOffset = size_t(y) * wordsPerRow;
+        for (int k = 0; k < wordsPerRow; ++k)
+        {
+            const uint64_t mask = mines.getWordMask(k);
+            const uint64_t mineWord = isGenerated ? mineRows[rowOffset + k] & mask : 0u;
+            mines.row(y)[k] = mineWord;
+            revealed.row(y)[k] = revealedRows[rowOffset + k] & mask;
+            flagged.row(y)[k] = flaggedRows[rowOffset + k] & mask;
+            nRevealedSafeTiles += popCount(revealed.row(y)[k] & ~mineWord);
+            isMineTriggered |= (revealed.row(y)[k] & mineWord) != 0;
+        }
+    }
+    if (isGenerated)
+    {
+        if (floodRegion.getHeight() != height)
+        {
+            allocateScratch(nullptr);
+        }
+        countAdjacentMines(mines, adjacentMines);
+    }
+    zeroRegionStart.clear();
+    if (isGenerated && isZeroRegionIndexEnabled)
+    {
+        buildZeroRegionIndex();
+    }
+}
+
+size_t Board::getPlaneStride(int width, int height)
+{
+    const size_t nWords = BitPlane::getWordCount(width, height);
+    return (nWords + PLANE_ALIGNMENT_WORDS - 1) / PLANE_ALIGNMENT_WORDS * PLANE_ALIGNMENT_WORDS;
+}
+
+size_t Board::getStorageWordCount(int width, int height)
+{
+    return N_PLANES * getPlaneStride(width, height);
+}
+
+void Board::reset(uint64_t _seed)
+{
+    // THE ADJACENCY PLANES ARE REWRITTEN WHOLE BY THE NEXT generate() AND THE FLOOD REGION IS LEFT EMPTY
+    // AFTER EVERY FLOOD, SO ONLY THE PLANES OF THE GAME STATE NEED CLEARING
+    seed = _seed;
+    isGenerated = false;
+    nRevealedSafeTiles = 0;
+    isMineTriggered = false;
+    mines.clear();
+    revealed.clear();
+    flagged.clear();
+    zeroRegionStart.clear();
+}
+
+void Board::allocateScratch(uint64_t* storage)
+{
+    // THE PLANES AFTER MINES, REVEALED AND FLAGGED IN THE CALLER'S STORAGE, OR OWNED ONES WITHOUT IT
+    const size_t planeStride = getPlaneStride(width, height);
+    for (int i = 0; i < ADJACENCY_COUNT_BITS; ++i)
+    {
+        adjacentMines[i] = storage ? BitPlane(width, height, storage + (3 + i) * planeStride) : BitPlane(width, height);
+    }
+    floodRegion = storage ? BitPlane(width, height, storage + (N_PLANES - 1) * planeStride) : BitPlane(width, height);
+    floodRows.reserve(height);
+    isFloodRowQueued.assign(height, 0);
+    floodRowWords.resize(mines.getWordsPerRow());
+    floodRowMask.resize(mines.getWordsPerRow());
+}
+
+void Board::generate(const Vei2& firstRevealedPos)
+{
+    // KEEP THE FIRST REVEALED TILE AND ITS NEIGHBORS FREE OF MINES, OR ONLY THE TILE ITSELF WHEN THE
+    // BOARD IS TOO DENSE TO SPARE ALL OF THEM
+    RectI mineFreeRegion = RectI(firstRevealedPos, 1, 1).GetExpanded(1);
+    const int nFreeTiles = (std::min(width, mineFreeRegion.right) - std::max(0, mineFreeRegion.left))
+        * (std::min(height, mineFreeRegion.bottom) - std::max(0, mineFreeRegion.top));
+    if (nMines > width * height - nFreeTiles)
+    {
+        mineFreeRegion = RectI(firstRevealedPos, 1, 1);
+    }
+
+    SplitMix64 rng(seed);
+    placeMines(rng, mineFreeRegion);
+
+    if (floodRegion.getHeight() != height)
+    {
+        allocateScratch(nullptr);
+    }
+    countAdjacentMines(mines, adjacentMines);
+    isGenerated = true;
+    if (isZeroRegionIndexEnabled)
+    {
+        buildZeroRegionIndex();
+    }
+}
+
+void Board::placeMines(SplitMix64& rng, const RectI& mineFreeRegion)
+{
+    // CLIP THE MINE FREE REGION TO THE BOARD; THE REMAINING TILES ARE NUMBERED ROW BY ROW, SKIPPING THE REGION
+    const int left = std::max(0, std::min(width, mineFreeRegion.left));
+    const int right = std::max(left, std::min(width, mineFreeRegion.right));
+    const int top = std::max(0, std::min(height, mineFreeRegion.top));
+    const int bottom = std::max(top, std::min(height, mineFreeRegion.bottom));
+    const int regionWidth = right - left;
+    const int rowWidthBeside = width - regionWidth;
+    const int nTilesAbove = top * width;
+    const int nTilesBeside = (bottom - top) * rowWidthBeside;
+    const int nCandidates = width * height - regionWidth * (bottom - top);
+    assert(nMines <= nCandidates);
+
+    auto candidateToGridPos = [=](int index)
+    {
+        if (index < nTilesAbove)
+        {
+            return Vei2(index % width, index / width);
+        }
+        index -= nTilesAbove;
+        if (index < nTilesBeside)
+        {
+            const int x = index % rowWidthBeside;
+            return Vei2(x < left ? x : x + regionWidth, top + index / rowWidthBeside);
+        }
+        index -= nTilesBeside;
+        return Vei2(index % width, bottom + index / width);
+    };
+
+    // ON DENSE BOARDS IT IS CHEAPER TO FILL EVERY CANDIDATE AND SAMPLE THE SAFE TILES INSTEAD
+    const bool sampleSafeTiles = nMines > nCandidates / 2;
+    if (sampleSafeTiles)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            uint64_t* row = mines.row(y);
+            for (int k = 0; k < mines.getWordsPerRow(); ++k)
+            {
+                row[k] = mines.getWordMask(k);
+            }
+            if (y >= top && y < bottom)
+            {
+                for (int x = left; x < right; ++x)
+                {
+                    mines.reset(x, y);
+                }
+            }
+        }
+    }
+
+    // FLOYD'S SAMPLING: ONE DRAW PER SAMPLED TILE AND NO RETRIES AT ANY DENSITY. THE MINE PLANE ITSELF IS
+    // THE MEMBERSHIP SET (A TILE IS SAMPLED ONCE IT DIFFERS FROM ITS INITIAL STATE), SO NO EXTRA MEMORY IS NEEDED
+    const int nSamples = sampleSafeTiles ? nCandidates - nMines : nMines;
+    for (int j = nCandidates - nSamples; j < nCandidates; ++j)
+    {
+        Vei2 gridPos = candidateToGridPos(int(rng.nextBelow(uint32_t(j) + 1u)));
+        if (mines.get(gridPos.x, gridPos.y) != sampleSafeTiles)
+        {
+            gridPos = candidateToGridPos(j);
+        }
+        mines.toggle(gridPos.x, gridPos.y);
+    }
+}
+
+void Board::revealTile(const Vei2& gridPos, Delta* delta)
+{
+    assert(isWithinBoard(gridPos));
+    if (delta)
+    {
+        delta->clear();
+    }
+    if (revealed.get(gridPos.x, gridPos.y) || flagged.get(gridPos.x, gridPos.y)) return;
+    if (!isGenerated)
+    {
+        generate(gridPos);
+        if (delta)
+        {
+            delta->hasPlacedMines = true;
+            delta->firstRevealedPos = gridPos;
+        }
+    }
+
+    const uint64_t tileBit = uint64_t(1) << (gridPos.x & 63);
+    if (mines.get(gridPos.x, gridPos.y))
+    {
+        flipWord(gridPos.y, gridPos.x >> 6, tileBit, 0u, delta);
+        if (delta)
+        {
+            delta->hasTriggeredMine = !isMineTriggered;
+        }
+        isMineTriggered = true;
+        return;
+    }
+    const int nRevealedBefore = nRevealedSafeTiles;
+    if (getNumberOfAdjacentMines(gridPos) == 0)
+    {
+        if (zeroRegionStart.empty() || !revealZeroRegion(zeroRegionOfTile[size_t(gridPos.y) * width + gridPos.x], delta))
+        {
+            revealConnectedSafeTiles(gridPos, delta);
+        }
+    }
+    else {
+        flipWord(gridPos.y, gridPos.x >> 6, tileBit, 0u, delta);
+        ++nRevealedSafeTiles;
+    }
+    if (delta)
+    {
+        delta->nRevealedSafeTilesChange = nRevealedSafeTiles - nRevealedBefore;
+    }
+}
+
+void Board::flagTile(const Vei2& gridPos, Delta* delta)
+{
+    assert(isWithinBoard(gridPos));
+    if (delta)
+    {
+        delta->clear();
+    }
+    if (!revealed.get(gridPos.x, gridPos.y))
+    {
+        flipWord(gridPos.y, gridPos.x >> 6, 0u, uint64_t(1) << (gridPos.x & 63), delta);
+    }
+}
+
+void Board::flipWord(int y, int k, uint64_t revealedBits, uint64_t flaggedBits, Delta* delta)
+{
+    revealed.row(y)[k] ^= revealedBits;
+    flagged.row(y)[k] ^= flaggedBits;
+    if (delta)
+    {
+        delta->changes.push_back({ y, k, revealedBits, flaggedBits });
+    }
+}
+
+void Board::revert(const Delta& delta)
+{
+    for (const Delta::WordChange& change : delta.changes)
+    {
+        revealed.row(change.y)[change.k] ^= change.revealedBits;
+        flagged.row(change.y)[change.k] ^= change.flaggedBits;
+    }
+    nRevealedSafeTiles -= delta.nRevealedSafeTilesChange;
+    if (delta.hasTriggeredMine)
+    {
+        isMineTriggered = false;
+    }
+    if (delta.hasPlacedMines)
+    {
+        // THE ONLY REVERT THAT COSTS THE SIZE OF THE BOARD; THE SAME FIRST REVEAL PLACES THE SAME MINES AGAIN
+        mines.clear();
+        isGenerated = false;
+        zeroRegionStart.clear();
+    }
+}
+
+void Board::apply(const Delta& delta)
+{
+    if (delta.hasPlacedMines)
+    {
+        generate(delta.firstRevealedPos);
+    }
+    for (const Delta::WordChange& change : delta.changes)
+    {
+        revealed.row(change.y)[change.k] ^= change.revealedBits;
+        flagged.row(change.y)[change.k] ^= change.flaggedBits;
+    }
+    nRevealedSafeTiles += delta.nRevealedSafeTilesChange;
+    if (delta.hasTriggeredMine)
+    {
+        isMineTriggered = true;
+    }
+}
+
+void Board::Delta::clear()
+{
+    changes.clear();
+    nRevealedSafeTilesChange = 0;
+    hasTriggeredMine = false;
+    hasPlacedMines = false;
+}
+
+bool Board::Delta::isEmpty() const
+{
+    return changes.empty() && !hasPlacedMines;
+}
+
+size_t Board::Delta::getMemoryFootprint() const
+{
+    return sizeof(Delta) + changes.capacity() * sizeof(WordChange);
+}
+
+bool Board::isWithinBoard(const Vei2& gridPos) const
+{
+    return gridPos.x >= 0 && gridPos.x < width && gridPos.y >= 0 && gridPos.y < height;
+}
+
+bool Board::isRevealed(const Vei2& gridPos) const
+{
+    assert(isWithinBoard(gridPos));
+    return revealed.get(gridPos.x, gridPos.y);
+}
+
+bool Board::isFlagged(const Vei2& gridPos) const
+{
+    assert(isWithinBoard(gridPos));
+    return flagged.get(gridPos.x, gridPos.y);
+}
+
+bool Board::hasMine(const Vei2& gridPos) const
+{
+    assert(isWithinBoard(gridPos));
+    return mines.get(gridPos.x, gridPos.y);
+}
+
+int Board::getNumberOfAdjacentMines(const Vei2& gridPos) const
+{
+    assert(isWithinBoard(gridPos));
+    if (!isGenerated) return 0;
+    int count = 0;
+    for (int i = 0; i < ADJACENCY_COUNT_BITS; ++i)
+    {
+        count |= int(adjacentMines[i].get(gridPos.x, gridPos.y)) << i;
+    }
+    return count;
+}
+
+int Board::getWidth() const
+{
+    return width;
+}
+
+int Board::getHeight() const
+{
+    return height;
+}
+
+bool Board::minesPlaced() const
+{
+    return isGenerated;
+}
+
+uint64_t Board::getSeed() const
+{
+    return seed;
+}
+
+int Board::getNumberOfMines() const
+{
+    return nMines;
+}
+
+int Board::getNumberOfRevealedSafeTiles() const
+{
+    return nRevealedSafeTiles;
+}
+
+const BitPlane& Board::getMines() const
+{
+    return mines;
+}
+
+const BitPlane& Board::getRevealedTiles() const
+{
+    return revealed;
+}
+
+const BitPlane& Board::getFlaggedTiles() const
+{
+    return flagged;
+}
+
+bool Board::mineTriggered() const
+{
+    return isMineTriggered;
+}
+
+bool Board::allTilesRevealed() const
+{
+    int nSafeTiles = (width * height) - nMines;
+    return (nSafeTiles == nRevealedSafeTiles);
+}
+
+uint64_t Board::zeroTileMask(int y, int k) const
+{
+    // SAFE TILES WITHOUT ADJACENT MINES IN WORD k OF ROW y
+    uint64_t nonZero = mines.row(y)[k];
+    for (const BitPlane& plane : adjacentMines)
+    {
+        nonZero |= plane.row(y)[k];
+    }
+    return ~nonZero & mines.getWordMask(k);
+}
+
+void Board::enableZeroRegionIndex()
+{
+    isZeroRegionIndexEnabled = true;
+    if (isGenerated && zeroRegionStart.empty())
+    {
+        buildZeroRegionIndex();
+    }
+}
+
+int Board::getNumberOfZeroRegions() const
+{
+    return zeroRegionStart.empty() ? 0 : int(zeroRegionStart.size()) - 1;
+}
+
+void Board::buildZeroRegionIndex()
+{
+    // FIND THE HORIZONTAL RUNS OF ZERO TILES ROW BY ROW AND UNITE EACH RUN WITH THE RUNS OF THE ROW ABOVE THAT
+    // TOUCH IT, DIAGONALS INCLUDED, LIKE THE FLOOD FILL
+    struct Run
+    {
+        int y;
+        int first;
+        int last;
+    };
+    std::vector<Run> runs;
+    std::vector<int> parent;
+    auto find = [&parent](int run)
+    {
+        while (parent[run] != run)
+        {
+            parent[run] = parent[parent[run]];
+            run = parent[run];
+        }
+        return run;
+    };
+    const int wordsPerRow = mines.getWordsPerRow();
+    size_t previousRowStart = 0;
+    for (int y = 0; y < height; ++y)
+    {
+        const size_t rowStart = runs.size();
+        for (int k = 0; k < wordsPerRow; ++k)
+        {
+            uint64_t word = zeroTileMask(y, k);
+            while (word)
+            {
+                const int low = countTrailingZeros(word);
+                const uint64_t shifted = ~(word >> low);
+                const int length = shifted == 0 ? 64 - low : std::min(countTrailingZeros(shifted), 64 - low);
+                const int first = k * 64 + low;
+                if (runs.size() > rowStart && runs.back().last == first - 1)
+                {
+                    runs.back().last = first + length - 1;
+                }
+                else {
+                    runs.push_back({ y, first, first + length - 1 });
+                    parent.push_back(int(parent.size()));
+                }
+                word &= length == 64 ? 0u : ~(((uint64_t(1) << length) - 1u) << low);
+            }
+        }
+        // THE RUNS OF THE ROW ABOVE ARE [previousRowStart, rowStart), SORTED LIKE THE ONES OF THIS ROW
+        size_t above = previousRowStart;
+        for (size_t i = rowStart; i < runs.size(); ++i)
+        {
+            while (above < rowStart && runs[above].last < runs[i].first - 1)
+            {
+                ++above;
+            }
+            for (size_t j = above; j < rowStart && runs[j].first <= runs[i].last + 1; ++j)
+            {
+                // THE OLDER ROOT STAYS THE ROOT, SO THE TREES STAY SHALLOW WHILE A LARGE REGION KEEPS GROWING
+                const int a = find(int(i));
+                const int b = find(int(j));
+                parent[std::max(a, b)] = std::min(a, b);
+            }
+        }
+        previousRowStart = rowStart;
+    }
+
+    // NUMBER THE REGIONS, LABEL THEIR TILES AND COUNT THEIR WORDS. THE RUNS ARE IN ROW ORDER, SO A REGION'S
+    // WORDS COME OUT SORTED BY ROW AND WORD, AND A RUN SHARES AT MOST ITS FIRST WORD WITH THE REGION'S PREVIOUS RUN
+    std::vector<int> regionOfRun(runs.size());
+    std::vector<int> regionOfRoot(runs.size(), -1);
+    std::vector<int> lastRow;
+    std::vector<int> lastWord;
+    zeroRegionStart.assign(1, 0);
+    zeroRegionOfTile.resize(size_t(width) * height);
+    for (size_t i = 0; i < runs.size(); ++i)
+    {
+        const Run& run = runs[i];
+        int& region = regionOfRoot[find(int(i))];
+        if (region < 0)
+        {
+            region = int(lastRow.size());
+            zeroRegionStart.push_back(0);
+            lastRow.push_back(-1);
+            lastWord.push_back(-1);
+        }
+        regionOfRun[i] = region;
+        std::fill(zeroRegionOfTile.begin() + size_t(run.y) * width + run.first,
+            zeroRegionOfTile.begin() + size_t(run.y) * width + run.last + 1, region);
+        const bool isFirstWordShared = lastRow[region] == run.y && lastWord[region] == run.first >> 6;
+        zeroRegionStart[region + 1] += (run.last >> 6) - (run.first >> 6) + (isFirstWordShared ? 0 : 1);
+        lastRow[region] = run.y;
+        lastWord[region] = run.last >> 6;
+    }
+    const int nRegions = int(lastRow.size());
+    for (int region = 0; region < nRegions; ++region)
+    {
+        zeroRegionStart[region + 1] += zeroRegionStart[region];
+    }
+
+    zeroRegionWords.resize(zeroRegionStart[nRegions]);
+    std::vector<int> fill(zeroRegionStart.begin(), zeroRegionStart.end() - 1);
+    for (size_t i = 0; i < runs.size(); ++i)
+    {
+        const Run& run = runs[i];
+        const int region = regionOfRun[i];
+        for (int k = run.first >> 6; k <= run.last >> 6; ++k)
+        {
+            const uint64_t zeroBits = columnMask(k, run.first, run.last);
+            ZeroRegionWord* const previous = fill[region] > zeroRegionStart[region]
+                ? &zeroRegionWords[fill[region] - 1] : nullptr;
+            if (previous && previous->y == run.y && previous->k == k)
+            {
+                previous->zeroBits |= zeroBits;
+            }
+            else {
+                zeroRegionWords[fill[region]++] = { run.y, k, zeroBits };
+            }
+        }
+    }
+}
+
+bool Board::revealZeroRegion(int region, Delta* delta)
+{
+    // A FLOOD REVEALS EXACTLY THE REGION AND THE TILES AROUND IT, UNLESS A FLAG BLOCKS IT OR SOME OF ITS ZERO
+    // TILES ARE ALREADY REVEALED (LEFT BEHIND BY A FLOOD THAT A FLAG STOPPED); THOSE CASES TAKE THE WALK.
+    // THE TILES AROUND A ZERO WORD ARE ITS BITS SPREAD BY A COLUMN, SPILLING INTO THE NEIGHBOR WORDS, ON THE
+    // ROW ABOVE, THE ROW ITSELF AND THE ROW BELOW; THE GUARDS ABSORB THE SPILLS OFF THE BOARD
+    const ZeroRegionWord* const begin = zeroRegionWords.data() + zeroRegionStart[region];
+    const ZeroRegionWord* const end = zeroRegionWords.data() + zeroRegionStart[region + 1];
+    for (const ZeroRegionWord* word = begin; word != end; ++word)
+    {
+        const uint64_t spread = word->zeroBits | (word->zeroBits << 1) | (word->zeroBits >> 1);
+        uint64_t blocked = revealed.row(word->y)[word->k] & word->zeroBits;
+        for (int y = word->y - 1; y <= word->y + 1; ++y)
+        {
+            const uint64_t* const row = flagged.row(y) + word->k;
+            blocked |= (row[-1] & (word->zeroBits << 63)) | (row[0] & spread) | (row[1] & (word->zeroBits >> 63));
+        }
+        if (blocked)
+        {
+            return false;
+        }
+    }
+    const int wordsPerRow = revealed.getWordsPerRow();
+    auto reveal = [this, wordsPerRow, delta](int y, int k, uint64_t bits)
+    {
+        if (y < 0 || y >= height || k < 0 || k >= wordsPerRow) return;
+        const uint64_t newlyRevealed = bits & ~revealed.row(y)[k] & revealed.getWordMask(k);
+        if (newlyRevealed)
+        {
+            flipWord(y, k, newlyRevealed, 0u, delta);
+            nRevealedSafeTiles += popCount(newlyRevealed);
+        }
+    };
+    for (const ZeroRegionWord* word = begin; word != end; ++word)
+    {
+        const uint64_t spread = word->zeroBits | (word->zeroBits << 1) | (word->zeroBits >> 1);
+        for (int y = word->y - 1; y <= word->y + 1; ++y)
+        {
+            reveal(y, word->k - 1, word->zeroBits << 63);
+            reveal(y, word->k, spread);
+            reveal(y, word->k + 1, word->zeroBits >> 63);
+        }
+    }
+    return true;
+}
+
+void Board::queueFloodRow(int y)
+{
+    if (y >= 0 && y < height && !isFloodRowQueued[y])
+    {
+        isFloodRowQueued[y] = 1;
+        floodRows.push_back(y);
+    }
+}
+
+bool Board::growFloodRow(int y)
+{
+    // THE REGION MAY GROW INTO THE HIDDEN ZERO TILES OF THIS ROW THAT TOUCH THE REGION IN THIS ROW OR
+    // THE ROWS ABOVE AND BELOW, AND FROM THERE ALONG EACH HORIZONTAL RUN OF HIDDEN ZERO TILES
+    const int wordsPerRow = floodRegion.getWordsPerRow();
+    const uint64_t* north = floodRegion.row(y - 1);
+    const uint64_t* south = floodRegion.row(y + 1);
+    uint64_t* region = floodRegion.row(y);
+    for (int k = 0; k < wordsPerRow; ++k)
+    {
+        const uint64_t vertical = north[k] | south[k] | region[k];
+        const uint64_t verticalWest = ((north[k] | south[k]) << 1) | ((north[k - 1] | south[k - 1]) >> 63);
+        const uint64_t verticalEast = ((north[k] | south[k]) >> 1) | ((north[k + 1] | south[k + 1]) << 63);
+        floodRowMask[k] = zeroTileMask(y, k) & ~revealed.row(y)[k] & ~flagged.row(y)[k];
+        floodRowWords[k] = (vertical | verticalWest | verticalEast) & floodRowMask[k];
+    }
+
+    uint64_t carry = 0;
+    for (int k = 0; k < wordsPerRow; ++k)
+    {
+        floodRowWords[k] = fillUp(floodRowWords[k] | carry, floodRowMask[k]);
+        carry = floodRowWords[k] >> 63;
+    }
+    carry = 0;
+    for (int k = wordsPerRow - 1; k >= 0; --k)
+    {
+        floodRowWords[k] = fillDown(floodRowWords[k] | (carry << 63), floodRowMask[k]);
+        carry = floodRowWords[k] & 1u;
+    }
+
+    bool changed = false;
+    for (int k = 0; k < wordsPerRow; ++k)
+    {
+        changed |= (floodRowWords[k] != region[k]);
+        region[k] = floodRowWords[k];
+    }
+    return changed;
+}
+
+void Board::revealConnectedSafeTiles(const Vei2& gridPos, Delta* delta)
+{
+    // GROW THE CONNECTED REGION OF HIDDEN ZERO TILES AROUND gridPos ROW BY ROW UNTIL NO ROW CHANGES,
+    // THEN REVEAL THE REGION TOGETHER WITH ITS BORDER IN ONE WORD-PARALLEL PASS
+    floodRegion.set(gridPos.x, gridPos.y);
+    int yMin = gridPos.y;
+    int yMax = gridPos.y;
+    queueFloodRow(gridPos.y - 1);
+    queueFloodRow(gridPos.y);
+    queueFloodRow(gridPos.y + 1);
+    while (!floodRows.empty())
+    {
+        const int y = floodRows.back();
+        floodRows.pop_back();
+        isFloodRowQueued[y] = 0;
+        if (growFloodRow(y))
+        {
+            yMin = std::min(yMin, y);
+            yMax = std::max(yMax, y);
+            queueFloodRow(y - 1);
+            queueFloodRow(y + 1);
+        }
+    }
+
+    const int wordsPerRow = floodRegion.getWordsPerRow();
+    for (int y = std::max(0, yMin - 1); y <= std::min(height - 1, yMax + 1); ++y)
+    {
+        const uint64_t* north = floodRegion.row(y - 1);
+        const uint64_t* center = floodRegion.row(y);
+        const uint64_t* south = floodRegion.row(y + 1);
+        for (int k = 0; k < wordsPerRow; ++k)
+        {
+            const uint64_t vertical = north[k] | center[k] | south[k];
+            const uint64_t verticalWest = (vertical << 1) | ((north[k - 1] | center[k - 1] | south[k - 1]) >> 63);
+            const uint64_t verticalEast = (vertical >> 1) | ((north[k + 1] | center[k + 1] | south[k + 1]) << 63);
+            const uint64_t newlyRevealed = (vertical | verticalWest | verticalEast)
+                & ~revealed.row(y)[k] & ~flagged.row(y)[k] & revealed.getWordMask(k);
+            if (newlyRevealed)
+            {
+                flipWord(y, k, newlyRevealed, 0u, delta);
+                nRevealedSafeTiles += popCount(newlyRevealed);
+            }
+        }
+    }
+    for (int y = yMin; y <= yMax; ++y)
+    {
+        std::fill(floodRegion.row(y), floodRegion.row(y) + wordsPerRow, uint64_t(0));
+    }
+}
@@ -0,0 +1,131 @@
+#pragma once
+#include "Vei2.h"
+#include "RectI.h"
+#include "BitPlane.h"
+#include "AdjacencyCount.h"
+#include "SplitMix64.h"
+#include <vector>
+
+// GAME LOGIC OF A MINEFIELD IN GRID COORDINATES, FREE OF ANY WINDOWS OR GRAPHICS DEPENDENCIES.
+// TILE STATE IS KEPT IN BITPLANES (MINES, REVEALED, FLAGGED AND FOUR BIT-SLICED PLANES FOR THE
+// ADJACENT MINE COUNT) SO NEIGHBOR COUNTING AND FLOOD FILLS WORK ON 64 TILES AT A TIME
+class Board
+{
+public:
+	// WHAT ONE MOVE CHANGED, FOR UNDO AND REDO: THE WORDS OF THE REVEALED AND FLAGGED PLANES IT FLIPPED (AS XOR
+	// MASKS) AND ITS EFFECT ON THE COUNTERS, SO REVERTING OR REAPPLYING IT COSTS TIME PROPORTIONAL TO ITS SIZE
+	struct Delta
+	{
+		struct WordChange
+		{
+			int y;
+			int k;
+			uint64_t revealedBits;
+			uint64_t flaggedBits;
+		};
+		void clear();
+		bool isEmpty() const;
+		size_t getMemoryFootprint() const;
+		std::vector<WordChange> changes;
+		int nRevealedSafeTilesChange = 0;
+		// THE MOVE REVEALED THE FIRST MINE
+		bool hasTriggeredMine = false;
+		// THE MOVE WAS THE FIRST REVEAL AND PLACED THE MINES
+		bool hasPlacedMines = false;
+		Vei2 firstRevealedPos = { 0, 0 };
+	};
+public:
+	// MINES ARE ONLY PLACED ON THE FIRST REVEAL, AWAY FROM THE REVEALED TILE AND ITS NEIGHBORS.
+	// THE SAME SEED AND FIRST REVEAL ALWAYS PRODUCE THE SAME MINES, ON EVERY PLATFORM
+	Board(int _width, int _height, int _nMines, uint64_t _seed);
+	// A BOARD WHOSE PLANES LIVE IN getStorageWordCount() WORDS AT storage (64-BYTE ALIGNED, OWNED BY THE CALLER).
+	// EVERYTHING IS ALLOCATED UP FRONT, SO NEITHER PLAYING NOR reset() EVER ALLOCATES
+	Board(int _width, int _height, int _nMines, uint64_t _seed, uint64_t* storage);
+	static size_t getStorageWordCount(int width, int height);
+	// STARTS A NEW GAME OF THE SAME SIZE FROM ANOTHER SEED, KEEPING ALL ALLOCATED MEMORY
+	void reset(uint64_t _seed);
+	// REPLACES THE STATE WITH SAVED PLANES, EACH height ROWS OF getWordsPerRow() WORDS WITHOUT GUARDS.
+	// mineRows IS nullptr FOR A BOARD WHOSE MINES WERE NOT PLACED YET; THE COUNTERS ARE DERIVED FROM THE PLANES
+	void restore(const uint64_t* mineRows, const uint64_t* revealedRows, const uint64_t* flaggedRows);
+	// FROM NOW ON, EVERY PLACEMENT OF THE MINES ALSO LABELS THE CONNECTED REGIONS OF ZERO TILES, SO REVEALING A
+	// ZERO TILE MARKS ITS WHOLE REGION WORD BY WORD INSTEAD OF WALKING IT. COSTS AN int PER TILE PLUS
+	// 16 BYTES PER WORD OF EVERY REGION; MEANT FOR LARGE BOARDS THAT ARE REVEALED MANY TIMES, AS IN SOLVER TRAINING
+	void enableZeroRegionIndex();
+	int getNumberOfZeroRegions() const;
+	// WITH A delta, IT IS CLEARED AND THEN RECEIVES WHAT THE MOVE CHANGED
+	void revealTile(const Vei2& gridPos, Delta* delta = nullptr);
+	void flagTile(const Vei2& gridPos, Delta* delta = nullptr);
+	// UNDOES THE LAST MOVE NOT YET REVERTED, WHICH MUST HAVE RECORDED delta
+	void revert(const Delta& delta);
+	// REDOES THE MOVE THAT delta WAS RECORDED FROM, RIGHT AFTER IT WAS REVERTED
+	void apply(const Delta& delta);
+	bool isWithinBoard(const Vei2& gridPos) const;
+	bool isRevealed(const Vei2& gridPos) const;
+	bool isFlagged(const Vei2& gridPos) const;
+	bool hasMine(const Vei2& gridPos) const;
+	int getNumberOfAdjacentMines(const Vei2& gridPos) const;
+	int getWidth() const;
+	int getHeight() const;
+	bool minesPlaced() const;
+	uint64_t getSeed() const;
+	int getNumberOfMines() const;
+	int getNumberOfRevealedSafeTiles() const;
+	const BitPlane& getMines() const;
+	const BitPlane& getRevealedTiles() const;
+	const BitPlane& getFlaggedTiles() const;
+	bool mineTriggered() const;
+	bool allTilesRevealed() const;
+private:
+	// THE ZERO TILES OF A REGION IN WORD k OF ROW y
+	struct ZeroRegionWord
+	{
+		int y;
+		int k;
+		uint64_t zeroBits;
+	};
+private:
+	void allocateScratch(uint64_t* storage);
+	void generate(const Vei2& firstRevealedPos);
+	// NO MINE IS PLACED INSIDE mineFreeRegion (GRID COORDINATES, RIGHT AND BOTTOM EXCLUSIVE)
+	void placeMines(SplitMix64& rng, const RectI& mineFreeRegion);
+	uint64_t zeroTileMask(int y, int k) const;
+	void revealConnectedSafeTiles(const Vei2& gridPos, Delta* delta);
+	void buildZeroRegionIndex();
+	// FALSE, CHANGING NOTHING, WHEN FLAGS OR EARLIER PARTIAL REVEALS WOULD MAKE A FLOOD STOP SHORT OF THE REGION
+	bool revealZeroRegion(int region, Delta* delta);
+	void flipWord(int y, int k, uint64_t revealedBits, uint64_t flaggedBits, Delta* delta);
+	bool growFloodRow(int y);
+	void queueFloodRow(int y);
+	static size_t getPlaneStride(int width, int height);
+private:
+	// PLANES IN CALLER STORAGE START ON A CACHE LINE
+	static constexpr int PLANE_ALIGNMENT_WORDS = 8;
+	// MINES, REVEALED, FLAGGED, THE ADJACENCY PLANES AND THE FLOOD REGION
+	static constexpr int N_PLANES = 3 + ADJACENCY_COUNT_BITS + 1;
+private:
+	int width;
+	int height;
+	int nMines;
+	uint64_t seed;
+	bool isGenerated;
+	int nRevealedSafeTiles;
+	bool isMineTriggered;
+	BitPlane mines;
+	BitPlane revealed;
+	BitPlane flagged;
+	// BIT i OF THE ADJACENT MINE COUNT OF EVERY TILE. THESE AND THE FLOOD FILL SCRATCH BELOW ARE ONLY
+	// ALLOCATED WHEN THE MINES ARE FIRST PLACED
+	BitPlane adjacentMines[ADJACENCY_COUNT_BITS];
+	// SCRATCH STATE OF THE FLOOD FILL, KEPT AS MEMBERS SO THEIR MEMORY IS REUSED BETWEEN REVEALS
+	BitPlane floodRegion;
+	std::vector<int> floodRows;
+	std::vector<unsigned char> isFloodRowQueued;
+	std::vector<uint64_t> floodRowWords;
+	std::vector<uint64_t> floodRowMask;
+	// THE ZERO REGION INDEX: THE REGION OF EVERY ZERO TILE, AND THE WORDS OF REGION r SORTED BY ROW IN
+	// zeroRegionWords[zeroRegionStart[r], zeroRegionStart[r + 1]). EMPTY WHEN THERE IS NO INDEX FOR THESE MINES
+	bool isZeroRegionIndexEnabled = false;
+	std::vector<int> zeroRegionOfTile;
+	std::vector<int> zeroRegionStart;
+	std::vector<ZeroRegionWord> zeroRegionWords;
+};
@@ -0,0 +1,241 @@
+#include "BoardFile.h"
+#include <assert.h>
+#include <climits>
+#include <cstring>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    const char MAGIC[8] = { 'M', 'I', 'N', 'E', 'B', 'R', 'D', '\0' };
+    // READS BACK AS 0x04030201 ON A MACHINE OF THE OTHER BYTE ORDER
+    const uint32_t BYTE_ORDER_MARK = 0x01020304u;
+
+    uint64_t planeBytes(uint32_t width, uint32_t height)
+    {
+        return uint64_t((width + 63) / 64) * height * sizeof(uint64_t);
+    }
+}
+
+namespace BoardFile
+{
+    int Record::getWordsPerRow() const
+    {
+        return int((header->width + 63) / 64);
+    }
+
+    double Record::getDensity() const
+    {
+        return double(header->nMines) / (double(header->width) * header->height);
+    }
+
+    bool Record::minesPlaced() const
+    {
+        return (header->flags & FLAG_MINES_PLACED) != 0;
+    }
+
+    Board Record::toBoard() const
+    {
+        Board board(int(header->width), int(header->height), int(header->nMines), header->seed);
+        board.restore(minesPlaced() ? mineRows : nullptr, revealedRows, flaggedRows);
+        return board;
+    }
+
+    Writer::~Writer()
+    {
+        if (file != nullptr)
+        {
+            close();
+        }
+    }
+
+    bool Writer::open(const std::string& path)
+    {
+        assert(file == nullptr);
+        file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr) return false;
+        offset = 0;
+        recordOffsets.clear();
+        isGood = true;
+        // PLACEHOLDER UNTIL close() KNOWS THE NUMBER OF BOARDS AND WHERE THE INDEX IS
+        const FileHeader header = {};
+        return write(&header, sizeof(header));
+    }
+
+    bool Writer::add(const Board& board)
+    {
+        assert(file != nullptr);
+        recordOffsets.push_back(offset);
+        RecordHeader header;
+        header.width = uint32_t(board.getWidth());
+        header.height = uint32_t(board.getHeight());
+        header.nMines = uint32_t(board.getNumberOfMines());
+        header.flags = board.minesPlaced() ? FLAG_MINES_PLACED : 0u;
+        header.seed = board.getSeed();
+        write(&header, sizeof(header));
+        writePlane(board.getMines(), board.getHeight());
+        writePlane(board.getRevealedTiles(), board.getHeight());
+        return writePlane(board.getFlaggedTiles(), board.getHeight());
+    }
+
+    bool Writer::close()
+    {
+        assert(file != nullptr);
+        FileHeader header;
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.byteOrderMark = BYTE_ORDER_MARK;
+        header.nBoards = recordOffsets.size();
+        header.indexOffset = offset;
+        write(recordOffsets.data(), recordOffsets.size() * sizeof(uint64_t));
+        isGood &= std::fseek(file, 0, SEEK_SET) == 0;
+        write(&header, sizeof(header));
+        isGood &= std::fclose(file) == 0;
+        file = nullptr;
+        return isGood;
+    }
+
+    bool Writer::write(const void* data, size_t size)
+    {
+        isGood &= std::fwrite(data, 1, size, file) == size;
+        offset += size;
+        return isGood;
+    }
+
+    bool Writer::writePlane(const BitPlane& plane, int height)
+    {
+        // ROWS ONLY, WITHOUT THE GUARD WORDS AND GUARD ROWS
+        for (int y = 0; y < height; ++y)
+        {
+            write(plane.row(y), plane.getWordsPerRow() * sizeof(uint64_t));
+        }
+        return isGood;
+    }
+
+    Reader::~Reader()
+    {
+        close();
+    }
+
+    bool Reader::open(const std::string& path)
+    {
+        close();
+#ifdef _WIN32
+        fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            fileHandle = nullptr;
+            return false;
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart < LONGLONG(sizeof(FileHeader)))
+        {
+            close();
+            return false;
+        }
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const void* view = mappingHandle ? MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (view == nullptr)
+        {
+            close();
+            return false;
+        }
+        data = static_cast<const unsigned char*>(view);
+        size = uint64_t(fileSize.QuadPart);
+#else
+        const int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0) return false;
+        struct stat status;
+        if (fstat(descriptor, &status) != 0 || uint64_t(status.st_size) < sizeof(FileHeader))
+        {
+            ::close(descriptor);
+            return false;
+        }
+        void* view = mmap(nullptr, size_t(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+        // THE MAPPING KEEPS THE FILE ALIVE ON ITS OWN
+        ::close(descriptor);
+        if (view == MAP_FAILED) return false;
+        data = static_cast<const unsigned char*>(view);
+        size = uint64_t(status.st_size);
+#endif
+        const FileHeader* header = reinterpret_cast<const FileHeader*>(data);
+        const bool isValid = std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) == 0
+            && header->version == VERSION && header->byteOrderMark == BYTE_ORDER_MARK
+            && header->indexOffset % sizeof(uint64_t) == 0 && header->indexOffset <= size
+            && header->nBoards <= (size - header->indexOffset) / sizeof(uint64_t);
+        if (!isValid)
+        {
+            close();
+            return false;
+        }
+        nBoards = header->nBoards;
+        recordOffsets = reinterpret_cast<const uint64_t*>(data + header->indexOffset);
+        return true;
+    }
+
+    void Reader::close()
+    {
+#ifdef _WIN32
+        if (data != nullptr)
+        {
+            UnmapViewOfFile(data);
+        }
+        if (mappingHandle != nullptr)
+        {
+            CloseHandle(mappingHandle);
+        }
+        if (fileHandle != nullptr)
+        {
+            CloseHandle(fileHandle);
+        }
+        fileHandle = nullptr;
+        mappingHandle = nullptr;
+#else
+        if (data != nullptr)
+        {
+            munmap(const_cast<unsigned char*>(data), size_t(size));
+        }
+#endif
+        data = nullptr;
+        size = 0;
+        recordOffsets = nullptr;
+        nBoards = 0;
+    }
+
+    uint64_t Reader::getNumberOfBoards() const
+    {
+        return nBoards;
+    }
+
+    bool Reader::getRecord(uint64_t index, Record& record) const
+    {
+        assert(index < nBoards);
+        const uint64_t offset = recordOffsets[index];
+        if (offset % sizeof(uint64_t) != 0 || offset > size || size - offset < sizeof(RecordHeader)) return false;
+        const RecordHeader* header = reinterpret_cast<const RecordHeader*>(data + offset);
+        const uint64_t nPlaneBytes = planeBytes(header->width, header->height);
+        // A BOARD INDEXES ITS TILES WITH AN int, SO EVERY TILE (AND WITH IT EVERY MINE) MUST FIT IN ONE
+        const uint64_t nTiles = uint64_t(header->width) * header->height;
+        if (header->width == 0 || header->height == 0 || nTiles > uint64_t(INT_MAX)
+            || header->nMines == 0 || header->nMines >= nTiles
+            || (size - offset - sizeof(RecordHeader)) / 3 < nPlaneBytes)
+        {
+            return false;
+        }
+        const unsigned char* planes = data + offset + sizeof(RecordHeader);
+        record.header = header;
+        record.mineRows = reinterpret_cast<const uint64_t*>(planes);
+        record.revealedRows = reinterpret_cast<const uint64_t*>(planes + nPlaneBytes);
+        record.flaggedRows = reinterpret_cast<const uint64_t*>(planes + 2 * nPlaneBytes);
+        return true;
+    }
+}
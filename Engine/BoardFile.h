@@ -0,0 +1,95 @@
+#pragma once
+#include "Board.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// VERSIONED BINARY FILE OF BOARDS FOR REPLAYS, PUZZLES AND TEST CORPORA. LITTLE-ENDIAN, EVERYTHING 8-BYTE ALIGNED:
+//   HEADER   MAGIC "MINEBRD", VERSION, BYTE ORDER MARK, NUMBER OF BOARDS, OFFSET OF THE INDEX
+//   RECORDS  A RECORD HEADER (WIDTH, HEIGHT, NUMBER OF MINES, FLAGS, SEED) FOLLOWED BY THE MINE, REVEALED AND
+//            FLAGGED PLANES, EACH height ROWS OF (width + 63) / 64 WORDS
+//   INDEX    THE FILE OFFSET OF EVERY RECORD, WRITTEN LAST SO BOARDS CAN BE STREAMED OUT ONE BY ONE
+// THE READER MAPS THE FILE INTO MEMORY AND HANDS OUT RECORDS THAT POINT STRAIGHT INTO THE MAPPING, SO OPENING
+// BOARD i IS ONE INDEX LOOKUP WHATEVER THE SIZE OF THE FILE, AND NOTHING IS PARSED OR COPIED UNTIL IT IS USED
+namespace BoardFile
+{
+	constexpr uint32_t VERSION = 1;
+	constexpr uint32_t FLAG_MINES_PLACED = 1u;
+
+	struct FileHeader
+	{
+		char magic[8];
+		uint32_t version;
+		uint32_t byteOrderMark;
+		uint64_t nBoards;
+		uint64_t indexOffset;
+	};
+
+	struct RecordHeader
+	{
+		uint32_t width;
+		uint32_t height;
+		uint32_t nMines;
+		uint32_t flags;
+		uint64_t seed;
+	};
+
+	// A BOARD INSIDE A MAPPED FILE; ONLY VALID WHILE ITS Reader IS OPEN
+	struct Record
+	{
+		int getWordsPerRow() const;
+		double getDensity() const;
+		bool minesPlaced() const;
+		Board toBoard() const;
+		const RecordHeader* header;
+		const uint64_t* mineRows;
+		const uint64_t* revealedRows;
+		const uint64_t* flaggedRows;
+	};
+
+	class Writer
+	{
+	public:
+		Writer() = default;
+		Writer(const Writer&) = delete;
+		Writer& operator=(const Writer&) = delete;
+		~Writer();
+		bool open(const std::string& path);
+		bool add(const Board& board);
+		// WRITES THE INDEX AND THE FINAL HEADER; FALSE IF ANY WRITE FAILED
+		bool close();
+	private:
+		bool write(const void* data, size_t size);
+		bool writePlane(const BitPlane& plane, int height);
+	private:
+		std::FILE* file = nullptr;
+		uint64_t offset = 0;
+		std::vector<uint64_t> recordOffsets;
+		bool isGood = false;
+	};
+
+	class Reader
+	{
+	public:
+		Reader() = default;
+		Reader(const Reader&) = delete;
+		Reader& operator=(const Reader&) = delete;
+		~Reader();
+		// FALSE IF THE FILE CANNOT BE MAPPED OR IS NOT A BOARD FILE OF THIS VERSION
+		bool open(const std::string& path);
+		void close();
+		uint64_t getNumberOfBoards() const;
+		// FALSE IF THE INDEX POINTS OUTSIDE THE FILE OR THE RECORD DOES NOT DESCRIBE A VALID BOARD
+		bool getRecord(uint64_t index, Record& record) const;
+	private:
+		const unsigned char* data = nullptr;
+		uint64_t size = 0;
+		const uint64_t* recordOffsets = nullptr;
+		uint64_t nBoards = 0;
+#ifdef _WIN32
+		void* fileHandle = nullptr;
+		void* mappingHandle = nullptr;
+#endif
+	};
+}
@@ -0,0 +1,49 @@
+#include "BoardPool.h"
+#include <assert.h>
+
+BoardPool::BoardPool(int _width, int _height, int _nMines, int capacity)
+{
+    assert(capacity > 0);
+    const size_t boardWords = Board::getStorageWordCount(_width, _height);
+    storage.assign(boardWords * capacity + ALIGNMENT_WORDS - 1, 0u);
+    const uintptr_t address = reinterpret_cast<uintptr_t>(storage.data());
+    const size_t alignment = ALIGNMENT_WORDS * sizeof(uint64_t);
+    uint64_t* const block = storage.data() + ((alignment - address % alignment) % alignment) / sizeof(uint64_t);
+
+    boards.reserve(capacity);
+    availableBoards.reserve(capacity);
+    for (int i = 0; i < capacity; ++i)
+    {
+        boards.emplace_back(_width, _height, _nMines, 0, block + boardWords * i);
+    }
+    for (int i = capacity - 1; i >= 0; --i)
+    {
+        availableBoards.push_back(&boards[i]);
+    }
+}
+
+Board* BoardPool::acquire(uint64_t seed)
+{
+    if (availableBoards.empty()) return nullptr;
+    Board* const board = availableBoards.back();
+    availableBoards.pop_back();
+    board->reset(seed);
+    return board;
+}
+
+void BoardPool::release(Board* board)
+{
+    assert(board >= boards.data() && board < boards.data() + boards.size());
+    assert(availableBoards.size() < boards.size());
+    availableBoards.push_back(board);
+}
+
+int BoardPool::getCapacity() const
+{
+    return int(boards.size());
+}
+
+int BoardPool::getNumberOfAvailableBoards() const
+{
+    return int(availableBoards.size());
+}
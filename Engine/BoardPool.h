@@ -0,0 +1,27 @@
+#pragma once
+#include "Board.h"
+#include <cstdint>
+#include <vector>
+
+// A FIXED SET OF BOARDS OF ONE SIZE WHOSE PLANES SHARE A SINGLE CACHE-ALIGNED BLOCK, ALLOCATED ONCE.
+// acquire() HANDS OUT A BOARD RESET IN PLACE FOR A NEW GAME AND release() TAKES IT BACK, AND NEITHER ONE,
+// NOR PLAYING ON THE BOARD, TOUCHES THE HEAP. NOT THREAD-SAFE: USE ONE POOL PER THREAD
+class BoardPool
+{
+public:
+	BoardPool(int _width, int _height, int _nMines, int capacity);
+	BoardPool(const BoardPool&) = delete;
+	BoardPool& operator=(const BoardPool&) = delete;
+	// nullptr WHEN EVERY BOARD IS IN USE
+	Board* acquire(uint64_t seed);
+	void release(Board* board);
+	int getCapacity() const;
+	int getNumberOfAvailableBoards() const;
+private:
+	static constexpr size_t ALIGNMENT_WORDS = 8;
+private:
+	// OVER-ALLOCATED BY ONE CACHE LINE SO THE BOARDS CAN START ON A CACHE LINE BOUNDARY
+	std::vector<uint64_t> storage;
+	std::vector<Board> boards;
+	std::vector<Board*> availableBoards;
+};
@@ -0,0 +1,469 @@
+#include "EndlessField.h"
+#include "BitPlane.h"
+#include "SplitMix64.h"
+#include <assert.h>
+#include <algorithm>
+
+namespace
+{
+    constexpr int N_CHUNK_TILES = EndlessField::CHUNK_SIZE * EndlessField::CHUNK_SIZE;
+
+    void writeVarint(std::vector<unsigned char>& bytes, uint64_t value)
+    {
+        while (value >= 0x80u)
+        {
+            bytes.push_back((unsigned char)(value | 0x80u));
+            value >>= 7;
+        }
+        bytes.push_back((unsigned char)value);
+    }
+
+    uint64_t readVarint(const std::vector<unsigned char>& bytes, size_t& offset)
+    {
+        uint64_t value = 0;
+        int shift = 0;
+        unsigned char byte;
+        do
+        {
+            assert(offset < bytes.size() && shift < 64);
+            byte = bytes[offset++];
+            value |= uint64_t(byte & 0x7Fu) << shift;
+            shift += 7;
+        } while (byte & 0x80u);
+        return value;
+    }
+
+    // THE LENGTHS OF THE ALTERNATING RUNS OF CLEAR AND SET BITS OF words, STARTING WITH A (POSSIBLY EMPTY) CLEAR RUN
+    void encodeRuns(const uint64_t* words, int nWords, std::vector<unsigned char>& bytes)
+    {
+        const int nBits = nWords * 64;
+        int position = 0;
+        bool isSet = false;
+        while (position < nBits)
+        {
+            // THE NEXT BIT THAT DIFFERS FROM THE CURRENT RUN
+            const uint64_t flip = isSet ? ~uint64_t(0) : 0u;
+            int k = position >> 6;
+            uint64_t word = (words[k] ^ flip) & (~uint64_t(0) << (position & 63));
+            while (word == 0 && ++k < nWords)
+            {
+                word = words[k] ^ flip;
+            }
+            const int next = k < nWords ? k * 64 + countTrailingZeros(word) : nBits;
+            writeVarint(bytes, uint64_t(next - position));
+            position = next;
+            isSet = !isSet;
+        }
+    }
+
+    void decodeRuns(const std::vector<unsigned char>& bytes, uint64_t* words, int nWords)
+    {
+        std::fill(words, words + nWords, uint64_t(0));
+        size_t offset = 0;
+        int position = 0;
+        bool isSet = false;
+        while (offset < bytes.size())
+        {
+            const int length = int(readVarint(bytes, offset));
+            assert(position + length <= nWords * 64);
+            for (int bit = position; isSet && bit < position + length; ++bit)
+            {
+                words[bit >> 6] |= uint64_t(1) << (bit & 63);
+            }
+            position += length;
+            isSet = !isSet;
+        }
+    }
+
+    // ADDS ONE TO THE BIT-SLICED COUNT OF EVERY TILE SET IN bits
+    void addToCount(uint64_t (&count)[ADJACENCY_COUNT_BITS], uint64_t bits)
+    {
+        for (uint64_t& slice : count)
+        {
+            const uint64_t carry = slice & bits;
+            slice ^= bits;
+            bits = carry;
+        }
+    }
+}
+
+EndlessField::EndlessField(uint64_t _seed, int _nMinesPerChunk, int _maxResidentChunks, int _floodChunkBudget)
+    :seed(_seed), nMinesPerChunk(_nMinesPerChunk), maxResidentChunks(_maxResidentChunks),
+    floodChunkBudget(_floodChunkBudget)
+{
+    assert(_nMinesPerChunk > 0 && _nMinesPerChunk < N_CHUNK_TILES - 9);
+    assert(_maxResidentChunks > 0 && _floodChunkBudget > 0);
+}
+
+void EndlessField::revealTile(const Vei2& gridPos)
+{
+    const int cx = getChunkCoordinate(gridPos.x);
+    const int cy = getChunkCoordinate(gridPos.y);
+    const int y = gridPos.y - cy * CHUNK_SIZE;
+    const uint64_t tileBit = uint64_t(1) << (gridPos.x - cx * CHUNK_SIZE);
+    Chunk& chunk = *getChunk(cx, cy, true);
+    if ((chunk.revealed[y] | chunk.flagged[y]) & tileBit) return;
+
+    if (chunk.mines[y] & tileBit)
+    {
+        chunk.revealed[y] |= tileBit;
+        isMineTriggered = true;
+    }
+    else if (zeroTileMask(chunk, y) & tileBit)
+    {
+        uint64_t touched[CHUNK_SIZE] = {};
+        touched[y] = tileBit;
+        floodChunk(cx, cy, touched);
+        continueFlood();
+    }
+    else {
+        chunk.revealed[y] |= tileBit;
+        ++nRevealedSafeTiles;
+    }
+}
+
+void EndlessField::flagTile(const Vei2& gridPos)
+{
+    const int cx = getChunkCoordinate(gridPos.x);
+    const int cy = getChunkCoordinate(gridPos.y);
+    const int y = gridPos.y - cy * CHUNK_SIZE;
+    const uint64_t tileBit = uint64_t(1) << (gridPos.x - cx * CHUNK_SIZE);
+    Chunk& chunk = *getChunk(cx, cy, true);
+    if (!(chunk.revealed[y] & tileBit))
+    {
+        chunk.flagged[y] ^= tileBit;
+    }
+}
+
+bool EndlessField::continueFlood()
+{
+    for (int n = 0; n < floodChunkBudget && !pendingChunks.empty(); ++n)
+    {
+        const uint64_t key = pendingChunks.front();
+        pendingChunks.pop_front();
+        const auto found = pendingFloods.find(key);
+        const PendingFlood flood = found->second;
+        pendingFloods.erase(found);
+        floodChunk(flood.cx, flood.cy, flood.touched);
+    }
+    return isFloodPending();
+}
+
+bool EndlessField::isFloodPending() const
+{
+    return !pendingChunks.empty();
+}
+
+bool EndlessField::isRevealed(const Vei2& gridPos)
+{
+    const int cx = getChunkCoordinate(gridPos.x);
+    const int cy = getChunkCoordinate(gridPos.y);
+    const Chunk* chunk = getChunk(cx, cy, false);
+    return chunk && ((chunk->revealed[gridPos.y - cy * CHUNK_SIZE] >> (gridPos.x - cx * CHUNK_SIZE)) & 1u);
+}
+
+bool EndlessField::isFlagged(const Vei2& gridPos)
+{
+    const int cx = getChunkCoordinate(gridPos.x);
+    const int cy = getChunkCoordinate(gridPos.y);
+    const Chunk* chunk = getChunk(cx, cy, false);
+    return chunk && ((chunk->flagged[gridPos.y - cy * CHUNK_SIZE] >> (gridPos.x - cx * CHUNK_SIZE)) & 1u);
+}
+
+int EndlessField::getNumberOfAdjacentMines(const Vei2& gridPos)
+{
+    const int cx = getChunkCoordinate(gridPos.x);
+    const int cy = getChunkCoordinate(gridPos.y);
+    const Chunk& chunk = *getChunk(cx, cy, true);
+    const int y = gridPos.y - cy * CHUNK_SIZE;
+    const int x = gridPos.x - cx * CHUNK_SIZE;
+    int count = 0;
+    for (int i = 0; i < ADJACENCY_COUNT_BITS; ++i)
+    {
+        count |= int((chunk.adjacentMines[i][y] >> x) & 1u) << i;
+    }
+    return count;
+}
+
+bool EndlessField::hasMine(const Vei2& gridPos) const
+{
+    const int cx = getChunkCoordinate(gridPos.x);
+    const int cy = getChunkCoordinate(gridPos.y);
+    const int y = gridPos.y - cy * CHUNK_SIZE;
+    const int x = gridPos.x - cx * CHUNK_SIZE;
+    const auto found = residentChunks.find(getChunkKey(cx, cy));
+    if (found != residentChunks.end())
+    {
+        return (found->second.mines[y] >> x) & 1u;
+    }
+    uint64_t mines[CHUNK_SIZE];
+    generateMines(cx, cy, mines);
+    return (mines[y] >> x) & 1u;
+}
+
+bool EndlessField::mineTriggered() const
+{
+    return isMineTriggered;
+}
+
+uint64_t EndlessField::getSeed() const
+{
+    return seed;
+}
+
+long long EndlessField::getNumberOfRevealedSafeTiles() const
+{
+    return nRevealedSafeTiles;
+}
+
+int EndlessField::getNumberOfResidentChunks() const
+{
+    return int(residentChunks.size());
+}
+
+int EndlessField::getNumberOfStoredChunks() const
+{
+    return int(storedChunks.size());
+}
+
+size_t EndlessField::getStoredBytes() const
+{
+    return nStoredBytes;
+}
+
+uint64_t EndlessField::getChunkKey(int cx, int cy)
+{
+    return (uint64_t(uint32_t(cx)) << 32) | uint32_t(cy);
+}
+
+int EndlessField::getChunkCoordinate(int tileCoordinate)
+{
+    // ROUNDED DOWN, ALSO FOR NEGATIVE TILES
+    return tileCoordinate >= 0 ? tileCoordinate / CHUNK_SIZE : -((-tileCoordinate - 1) / CHUNK_SIZE) - 1;
+}
+
+void EndlessField::generateMines(int cx, int cy, uint64_t (&rows)[CHUNK_SIZE]) const
+{
+    // FLOYD'S SAMPLING OVER THE TILES OF THE CHUNK, FROM A STREAM OF ITS OWN (SEE Board::placeMines)
+    SplitMix64 rng(SplitMix64::at(seed, getChunkKey(cx, cy)));
+    std::fill(rows, rows + CHUNK_SIZE, uint64_t(0));
+    for (int j = N_CHUNK_TILES - nMinesPerChunk; j < N_CHUNK_TILES; ++j)
+    {
+        int tile = int(rng.nextBelow(uint32_t(j) + 1u));
+        if ((rows[tile / CHUNK_SIZE] >> (tile % CHUNK_SIZE)) & 1u)
+        {
+            tile = j;
+        }
+        rows[tile / CHUNK_SIZE] |= uint64_t(1) << (tile % CHUNK_SIZE);
+    }
+    for (int y = -1; y <= 1; ++y)
+    {
+        for (int x = -1; x <= 1; ++x)
+        {
+            if (getChunkCoordinate(x) == cx && getChunkCoordinate(y) == cy)
+            {
+                rows[y - cy * CHUNK_SIZE] &= ~(uint64_t(1) << (x - cx * CHUNK_SIZE));
+            }
+        }
+    }
+}
+
+EndlessField::Chunk* EndlessField::getChunk(int cx, int cy, bool canGenerate)
+{
+    const uint64_t key = getChunkKey(cx, cy);
+    const auto found = residentChunks.find(key);
+    if (found != residentChunks.end())
+    {
+        recentChunks.splice(recentChunks.begin(), recentChunks, found->second.recentPosition);
+        return &found->second;
+    }
+    const auto stored = storedChunks.find(key);
+    if (stored == storedChunks.end())
+    {
+        return canGenerate ? &addChunk(cx, cy) : nullptr;
+    }
+    const std::vector<unsigned char> bytes = std::move(stored->second);
+    storedChunks.erase(stored);
+    nStoredBytes -= bytes.size();
+    Chunk& chunk = addChunk(cx, cy);
+    uint64_t planes[2 * CHUNK_SIZE];
+    decodeRuns(bytes, planes, 2 * CHUNK_SIZE);
+    std::copy(planes, planes + CHUNK_SIZE, chunk.revealed);
+    std::copy(planes + CHUNK_SIZE, planes + 2 * CHUNK_SIZE, chunk.flagged);
+    return &chunk;
+}
+
+EndlessField::Chunk& EndlessField::addChunk(int cx, int cy)
+{
+    if (int(residentChunks.size()) >= maxResidentChunks)
+    {
+        evictLeastRecentChunk();
+    }
+    const uint64_t key = getChunkKey(cx, cy);
+    Chunk& chunk = residentChunks[key];
+    recentChunks.push_front(key);
+    chunk.recentPosition = recentChunks.begin();
+    std::fill(chunk.revealed, chunk.revealed + CHUNK_SIZE, uint64_t(0));
+    std::fill(chunk.flagged, chunk.flagged + CHUNK_SIZE, uint64_t(0));
+
+    // THE MINES OF THE 3x3 CHUNKS AROUND IT, TAKEN FROM THE RESIDENT ONES OR GENERATED AGAIN
+    uint64_t neighborhood[3][3][CHUNK_SIZE];
+    for (int dy = -1; dy <= 1; ++dy)
+    {
+        for (int dx = -1; dx <= 1; ++dx)
+        {
+            uint64_t (&rows)[CHUNK_SIZE] = neighborhood[dy + 1][dx + 1];
+            const auto found = dx == 0 && dy == 0 ? residentChunks.end() : residentChunks.find(getChunkKey(cx + dx, cy + dy));
+            if (found != residentChunks.end())
+            {
+                std::copy(found->second.mines, found->second.mines + CHUNK_SIZE, rows);
+            }
+            else {
+                generateMines(cx + dx, cy + dy, rows);
+            }
+        }
+    }
+    std::copy(neighborhood[1][1], neighborhood[1][1] + CHUNK_SIZE, chunk.mines);
+
+    // COUNT THE EIGHT NEIGHBORS OF EVERY TILE; ROW y OF THE CHUNK SEES ROWS y - 1 TO y + 1, WITH THE COLUMNS
+    // BEYOND ITS EDGES TAKEN FROM THE CHUNKS ON EITHER SIDE
+    auto extendedRow = [&neighborhood](int y, uint64_t& west, uint64_t& center, uint64_t& east)
+    {
+        const int dy = y < 0 ? 0 : (y >= CHUNK_SIZE ? 2 : 1);
+        const int row = y & (CHUNK_SIZE - 1);
+        center = neighborhood[dy][1][row];
+        west = (center << 1) | (neighborhood[dy][0][row] >> 63);
+        east = (center >> 1) | (neighborhood[dy][2][row] << 63);
+    };
+    for (int y = 0; y < CHUNK_SIZE; ++y)
+    {
+        uint64_t count[ADJACENCY_COUNT_BITS] = {};
+        uint64_t west;
+        uint64_t center;
+        uint64_t east;
+        extendedRow(y - 1, west, center, east);
+        addToCount(count, west);
+        addToCount(count, center);
+        addToCount(count, east);
+        extendedRow(y, west, center, east);
+        addToCount(count, west);
+        addToCount(count, east);
+        extendedRow(y + 1, west, center, east);
+        addToCount(count, west);
+        addToCount(count, center);
+        addToCount(count, east);
+        for (int i = 0; i < ADJACENCY_COUNT_BITS; ++i)
+        {
+            chunk.adjacentMines[i][y] = count[i];
+        }
+    }
+    return chunk;
+}
+
+void EndlessField::evictLeastRecentChunk()
+{
+    // CHUNKS THE PLAYER NEVER CHANGED ARE DROPPED; THE SEED GENERATES THEM AGAIN
+    const uint64_t key = recentChunks.back();
+    recentChunks.pop_back();
+    const auto found = residentChunks.find(key);
+    const Chunk& chunk = found->second;
+    uint64_t planes[2 * CHUNK_SIZE];
+    std::copy(chunk.revealed, chunk.revealed + CHUNK_SIZE, planes);
+    std::copy(chunk.flagged, chunk.flagged + CHUNK_SIZE, planes + CHUNK_SIZE);
+    if (std::any_of(planes, planes + 2 * CHUNK_SIZE, [](uint64_t word) { return word != 0; }))
+    {
+        std::vector<unsigned char>& bytes = storedChunks[key];
+        encodeRuns(planes, 2 * CHUNK_SIZE, bytes);
+        bytes.shrink_to_fit();
+        nStoredBytes += bytes.size();
+    }
+    residentChunks.erase(found);
+}
+
+uint64_t EndlessField::zeroTileMask(const Chunk& chunk, int y) const
+{
+    uint64_t nonZero = chunk.mines[y];
+    for (int i = 0; i < ADJACENCY_COUNT_BITS; ++i)
+    {
+        nonZero |= chunk.adjacentMines[i][y];
+    }
+    return ~nonZero;
+}
+
+void EndlessField::floodChunk(int cx, int cy, const uint64_t (&touched)[CHUNK_SIZE])
+{
+    // THE TOUCHED TILES ARE REVEALED; THE HIDDEN ZERO TILES AMONG THEM GROW INTO THEIR CONNECTED REGION INSIDE THE
+    // CHUNK, SWEEPING DOWN AND UP UNTIL NO ROW CHANGES, AND THE REGION IS REVEALED TOGETHER WITH ITS BORDER.
+    // THE PARTS OF THE BORDER IN OTHER CHUNKS ARE SPILLED INTO THEIR PENDING FLOODS
+    Chunk& chunk = *getChunk(cx, cy, true);
+    uint64_t hidden[CHUNK_SIZE];
+    uint64_t region[CHUNK_SIZE + 2] = {};
+    uint64_t* const regionRow = region + 1;
+    for (int y = 0; y < CHUNK_SIZE; ++y)
+    {
+        hidden[y] = zeroTileMask(chunk, y) & ~chunk.revealed[y] & ~chunk.flagged[y];
+        regionRow[y] = touched[y] & hidden[y];
+    }
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            for (int i = 0; i < CHUNK_SIZE; ++i)
+            {
+                const int y = pass == 0 ? i : CHUNK_SIZE - 1 - i;
+                const uint64_t vertical = regionRow[y - 1] | regionRow[y + 1];
+                const uint64_t seeds = regionRow[y] | vertical | (vertical << 1) | (vertical >> 1);
+                const uint64_t grown = fillDown(fillUp(seeds, hidden[y]), hidden[y]);
+                if (grown != regionRow[y])
+                {
+                    regionRow[y] = grown;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    for (int y = -1; y <= CHUNK_SIZE; ++y)
+    {
+        const bool isInside = y >= 0 && y < CHUNK_SIZE;
+        const uint64_t vertical = (y > 0 ? regionRow[y - 1] : 0u) | (isInside ? regionRow[y] : 0u)
+            | (y < CHUNK_SIZE - 1 ? regionRow[y + 1] : 0u);
+        const uint64_t spread = vertical | (vertical << 1) | (vertical >> 1);
+        if (isInside)
+        {
+            const uint64_t newlyRevealed = (spread | touched[y]) & ~chunk.revealed[y] & ~chunk.flagged[y];
+            chunk.revealed[y] |= newlyRevealed;
+            nRevealedSafeTiles += popCount(newlyRevealed);
+        }
+        if (vertical == 0) continue;
+        const int dy = y < 0 ? -1 : (isInside ? 0 : 1);
+        const int row = y & (CHUNK_SIZE - 1);
+        if (!isInside)
+        {
+            spillFlood(cx, cy + dy, row, spread);
+        }
+        spillFlood(cx - 1, cy + dy, row, vertical << 63);
+        spillFlood(cx + 1, cy + dy, row, vertical >> 63);
+    }
+}
+
+void EndlessField::spillFlood(int cx, int cy, int y, uint64_t bits)
+{
+    if (bits == 0) return;
+    const uint64_t key = getChunkKey(cx, cy);
+    // A RESIDENT CHUNK WHERE THE FLOOD HAS NOTHING LEFT TO DO IS NOT QUEUED
+    const auto resident = residentChunks.find(key);
+    if (resident != residentChunks.end() && (bits & ~resident->second.revealed[y] & ~resident->second.flagged[y]) == 0)
+    {
+        return;
+    }
+    auto found = pendingFloods.find(key);
+    if (found == pendingFloods.end())
+    {
+        found = pendingFloods.emplace(key, PendingFlood{ cx, cy, {} }).first;
+        pendingChunks.push_back(key);
+    }
+    found->second.touched[y] |= bits;
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include "Vei2.h"
+#include "AdjacencyCount.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+// A MINEFIELD WITHOUT EDGES, MADE OF 64x64 CHUNKS. THE MINES OF A CHUNK ONLY DEPEND ON THE SEED AND THE CHUNK'S
+// COORDINATES, SO A CHUNK IS GENERATED WHEN A MOVE FIRST TOUCHES IT AND UNTOUCHED CHUNKS TAKE NO MEMORY.
+// AT MOST maxResidentChunks CHUNKS ARE KEPT IN MEMORY; THE LEAST RECENTLY USED ONE IS EVICTED, AND IF THE PLAYER
+// REVEALED OR FLAGGED ANYTHING IN IT, ITS REVEALED AND FLAGGED TILES ARE RUN-LENGTH ENCODED INTO A STORE FROM
+// WHICH IT IS REBUILT WHEN TOUCHED AGAIN (THE MINES AND COUNTS ARE REGENERATED FROM THE SEED).
+// A FLOOD GOES FROM CHUNK TO CHUNK THROUGH A QUEUE OF THE TILES IT SPILLS OVER THEIR BORDERS. A MOVE CARRIES IT
+// THROUGH AT MOST floodChunkBudget CHUNKS AND continueFlood() TAKES IT FURTHER, SO EVERY CALL TAKES BOUNDED TIME.
+// THE MEMORY IS ONLY BOUNDED BECAUSE A FLOOD ENDS: WITH FEWER THAN ABOUT 9% MINES THE ZERO TILES PERCOLATE, A
+// FLOOD CAN GO ON FOREVER, AND EVERY continueFlood() ADDS TO THE PENDING FLOODS AND THE STORED CHUNKS
+class EndlessField
+{
+public:
+	static constexpr int CHUNK_SIZE = 64;
+public:
+	// nMinesPerChunk OF THE 4096 TILES OF EVERY CHUNK ARE MINES, EXCEPT THAT THE ORIGIN AND ITS NEIGHBORS NEVER
+	// ARE, SO THE GAME CAN START BY REVEALING (0, 0)
+	EndlessField(uint64_t _seed, int _nMinesPerChunk, int _maxResidentChunks = 4096, int _floodChunkBudget = 256);
+	void revealTile(const Vei2& gridPos);
+	void flagTile(const Vei2& gridPos);
+	// TAKES A PENDING FLOOD THROUGH UP TO floodChunkBudget MORE CHUNKS; FALSE ONCE NOTHING IS PENDING
+	bool continueFlood();
+	bool isFloodPending() const;
+	// THESE LOAD THE CHUNK OF gridPos IF IT WAS EVICTED, BUT NEVER GENERATE ONE
+	bool isRevealed(const Vei2& gridPos);
+	bool isFlagged(const Vei2& gridPos);
+	// ONLY MEANINGFUL FOR REVEALED TILES, WHOSE CHUNK EXISTS
+	int getNumberOfAdjacentMines(const Vei2& gridPos);
+	bool hasMine(const Vei2& gridPos) const;
+	bool mineTriggered() const;
+	uint64_t getSeed() const;
+	long long getNumberOfRevealedSafeTiles() const;
+	int getNumberOfResidentChunks() const;
+	int getNumberOfStoredChunks() const;
+	size_t getStoredBytes() const;
+private:
+	struct Chunk
+	{
+		uint64_t mines[CHUNK_SIZE];
+		uint64_t revealed[CHUNK_SIZE];
+		uint64_t flagged[CHUNK_SIZE];
+		// BIT i OF THE ADJACENT MINE COUNT OF EVERY TILE, BIT-SLICED LIKE Board's PLANES
+		uint64_t adjacentMines[ADJACENCY_COUNT_BITS][CHUNK_SIZE];
+		std::list<uint64_t>::iterator recentPosition;
+	};
+	// THE TILES A FLOOD SPILLED INTO A CHUNK THAT IT HAS NOT REACHED YET
+	struct PendingFlood
+	{
+		int cx;
+		int cy;
+		uint64_t touched[CHUNK_SIZE];
+	};
+private:
+	static uint64_t getChunkKey(int cx, int cy);
+	static int getChunkCoordinate(int tileCoordinate);
+	void generateMines(int cx, int cy, uint64_t (&rows)[CHUNK_SIZE]) const;
+	// THE CHUNK, TOUCHED AS MOST RECENTLY USED. A CHUNK THAT NEVER EXISTED IS ONLY GENERATED IF canGenerate
+	Chunk* getChunk(int cx, int cy, bool canGenerate);
+	Chunk& addChunk(int cx, int cy);
+	void evictLeastRecentChunk();
+	uint64_t zeroTileMask(const Chunk& chunk, int y) const;
+	void floodChunk(int cx, int cy, const uint64_t (&touched)[CHUNK_SIZE]);
+	void spillFlood(int cx, int cy, int y, uint64_t bits);
+private:
+	uint64_t seed;
+	int nMinesPerChunk;
+	int maxResidentChunks;
+	int floodChunkBudget;
+	long long nRevealedSafeTiles = 0;
+	bool isMineTriggered = false;
+	std::unordered_map<uint64_t, Chunk> residentChunks;
+	// KEYS OF THE RESIDENT CHUNKS, MOST RECENTLY USED FIRST
+	std::list<uint64_t> recentChunks;
+	// REVEALED AND FLAGGED TILES OF EVICTED CHUNKS, AS VARINT LENGTHS OF ALTERNATING RUNS OF CLEAR AND SET BITS
+	std::unordered_map<uint64_t, std::vector<unsigned char>> storedChunks;
+	size_t nStoredBytes = 0;
+	std::unordered_map<uint64_t, PendingFlood> pendingFloods;
+	std::deque<uint64_t> pendingChunks;
+};
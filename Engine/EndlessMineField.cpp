@@ -0,0 +1,125 @@
+#include "EndlessMineField.h"
+#include <assert.h>
+#include <random>
+
+namespace
+{
+    // SHOWS THROUGH THE PARTS OF A TILE ITS SPRITES LEAVE UNDRAWN, AS IN MineField
+    constexpr Color BACKGROUND_COLOR = Colors::White;
+
+    uint64_t randomSeed()
+    {
+        std::random_device rd;
+        return (uint64_t(rd()) << 32) | rd();
+    }
+}
+
+EndlessMineField::EndlessMineField(int nMinesPerChunk)
+    :EndlessMineField(randomSeed(), nMinesPerChunk)
+{
+}
+
+EndlessMineField::EndlessMineField(uint64_t seed, int nMinesPerChunk)
+    :field(seed, nMinesPerChunk), viewOrigin(-VISIBLE_COLUMNS / 2, -VISIBLE_ROWS / 2), tileCache(BACKGROUND_COLOR),
+    rowTiles(VISIBLE_COLUMNS)
+{
+}
+
+const Color* EndlessMineField::getTileLook(const Vei2& gridPos)
+{
+    TileCache::State state = TileCache::State::Hidden;
+    int number = 0;
+    if (field.isRevealed(gridPos))
+    {
+        state = TileCache::State::Revealed;
+        number = field.getNumberOfAdjacentMines(gridPos);
+    }
+    else if (field.isFlagged(gridPos))
+    {
+        state = TileCache::State::Flagged;
+    }
+    // ONLY LOOK FOR A MINE WHERE IT SHOWS, SINCE A CHUNK THAT WAS NEVER TOUCHED HAS TO BE GENERATED TO TELL
+    if ((state == TileCache::State::Revealed || field.mineTriggered()) && field.hasMine(gridPos))
+    {
+        number = TileCache::MINE;
+    }
+    return tileCache.getTile(state, number, field.mineTriggered());
+}
+
+void EndlessMineField::draw(Graphics& gfx)
+{
+    if (!isRedrawNeeded) return;
+    const int tileSize = SpriteCodex::tileSize;
+    for (int y = 0; y < VISIBLE_ROWS; ++y)
+    {
+        for (int x = 0; x < VISIBLE_COLUMNS; ++x)
+        {
+            rowTiles[x] = getTileLook(viewOrigin + Vei2(x, y));
+        }
+        gfx.DrawTileRow(0, y * tileSize, tileSize, rowTiles.data(), VISIBLE_COLUMNS);
+    }
+    // THE STRIPS ALONG THE RIGHT AND BOTTOM EDGES THAT ARE TOO NARROW FOR A WHOLE TILE
+    gfx.DrawRect(VISIBLE_COLUMNS * tileSize, 0, Graphics::ScreenWidth, Graphics::ScreenHeight, Colors::Gray);
+    gfx.DrawRect(0, VISIBLE_ROWS * tileSize, Graphics::ScreenWidth, Graphics::ScreenHeight, Colors::Gray);
+    isRedrawNeeded = false;
+}
+
+bool EndlessMineField::hasChanges() const
+{
+    return isRedrawNeeded;
+}
+
+void EndlessMineField::requestFullRedraw()
+{
+    isRedrawNeeded = true;
+}
+
+void EndlessMineField::revealTile(const Vei2& pixelPos)
+{
+    field.revealTile(pixelToGridPosition(pixelPos));
+    isRedrawNeeded = true;
+}
+
+void EndlessMineField::flagTile(const Vei2& pixelPos)
+{
+    field.flagTile(pixelToGridPosition(pixelPos));
+    isRedrawNeeded = true;
+}
+
+void EndlessMineField::continueFlood()
+{
+    if (field.isFloodPending())
+    {
+        field.continueFlood();
+        isRedrawNeeded = true;
+    }
+}
+
+void EndlessMineField::pan(const Vei2& delta)
+{
+    viewOrigin += delta;
+    isRedrawNeeded = true;
+}
+
+bool EndlessMineField::mouseIsWithinField(const Mouse& mouse)
+{
+    const Vei2 pixelPos = mouse.GetPos();
+    return pixelPos.x >= 0 && pixelPos.x < VISIBLE_COLUMNS * SpriteCodex::tileSize
+        && pixelPos.y >= 0 && pixelPos.y < VISIBLE_ROWS * SpriteCodex::tileSize;
+}
+
+bool EndlessMineField::mineTriggered()
+{
+    return field.mineTriggered();
+}
+
+uint64_t EndlessMineField::getSeed() const
+{
+    return field.getSeed();
+}
+
+Vei2 EndlessMineField::pixelToGridPosition(const Vei2& pixelPos) const
+{
+    assert(pixelPos.x >= 0 && pixelPos.y >= 0);
+    return pixelPos / SpriteCodex::tileSize + viewOrigin;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include "Graphics.h"
+#include "Vei2.h"
+#include "SpriteCodex.h"
+#include "Mouse.h"
+#include "EndlessField.h"
+#include "TileCache.h"
+#include <vector>
+
+// RENDERS THE PART OF AN ENDLESS FIELD UNDER A VIEW THAT PANS ONE TILE AT A TIME, AND TRANSLATES MOUSE INPUT
+// INTO GRID COORDINATES. THE VIEW STARTS CENTERED ON THE ORIGIN, WHICH IS ALWAYS SAFE TO REVEAL
+class EndlessMineField
+{
+public:
+	EndlessMineField(int nMinesPerChunk);
+	EndlessMineField(uint64_t seed, int nMinesPerChunk);
+	// DRAWS EVERY VISIBLE TILE; A MOVE CAN FLOOD ANY NUMBER OF THEM, AND PANNING MOVES THEM ALL
+	void draw(Graphics& gfx);
+	bool hasChanges() const;
+	void requestFullRedraw();
+	void revealTile(const Vei2& pixelPos);
+	void flagTile(const Vei2& pixelPos);
+	// TAKES A FLOOD THAT A REVEAL LEFT PENDING A FEW MORE CHUNKS FURTHER, FOR CALLING ONCE PER FRAME
+	void continueFlood();
+	void pan(const Vei2& delta);
+	bool mouseIsWithinField(const Mouse& mouse);
+	bool mineTriggered();
+	uint64_t getSeed() const;
+private:
+	const Color* getTileLook(const Vei2& gridPos);
+	Vei2 pixelToGridPosition(const Vei2& pixelPos) const;
+private:
+	static constexpr int VISIBLE_COLUMNS = Graphics::ScreenWidth / SpriteCodex::tileSize;
+	static constexpr int VISIBLE_ROWS = Graphics::ScreenHeight / SpriteCodex::tileSize;
+private:
+	EndlessField field;
+	// GRID POSITION OF THE TILE IN THE TOP LEFT CORNER OF THE SCREEN
+	Vei2 viewOrigin;
+	bool isRedrawNeeded = true;
+	TileCache tileCache;
+	// THE TILES OF ONE ROW OF THE VIEW, DRAWN TOGETHER
+	std::vector<const Color*> rowTiles;
+};
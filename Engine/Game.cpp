@@ -25,20 +25,49 @@ Game::Game( MainWindow& wnd )
 	:
 	wnd( wnd ),
 	gfx( wnd ),
-	field(8)
+	field(10, 10, 8),
+	// ABOUT THE DENSITY OF AN EXPERT BOARD, FAR ABOVE THE ONE AT WHICH A FLOOD COULD GO ON FOREVER
+	endlessField(820)
 {
 }
 
 void Game::Go()
 {
-	gfx.BeginFrame();	
 	UpdateModel();
+	// the previous frame stays in the sysbuffer and only what the field changed is drawn over it, except right
+	// after switching fields, when the other field's frame is cleared away
+	if( isFrameClearNeeded )
+	{
+		gfx.BeginFrame();
+		isFrameClearNeeded = false;
+	}
+	else
+	{
+		gfx.BeginRetainedFrame( isEndless ? endlessField.hasChanges() : field.hasChanges() );
+	}
 	ComposeFrame();
 	gfx.EndFrame();
 }
 
 void Game::UpdateModel()
 {
+	while (!wnd.kbd.KeyIsEmpty())
+	{
+		const auto e = wnd.kbd.ReadKey();
+		if (e.IsPress() && e.GetCode() == VK_TAB)
+		{
+			isEndless = !isEndless;
+			isFrameClearNeeded = true;
+			field.requestFullRedraw();
+			endlessField.requestFullRedraw();
+		}
+	}
+	if (isEndless)
+	{
+		UpdateEndless();
+		return;
+	}
+
 	if (field.mineTriggered() || field.allTilesRevealed()) return;
 	// ONLY ATTEMPT TO REVEAL A TILE WHEN THE MOUSE WAS CLICKED INSIDE OF THE MINEFIELD
 	if (!wnd.mouse.IsEmpty() && field.mouseIsWithinField(wnd.mouse) == true)
@@ -55,8 +84,38 @@ void Game::UpdateModel()
 	}
 }
 
+void Game::UpdateEndless()
+{
+	// THE VIEW PANS ONE TILE PER FRAME WHILE AN ARROW KEY IS HELD, ALSO AFTER A MINE WENT OFF
+	const Vei2 pan((wnd.kbd.KeyIsPressed(VK_RIGHT) ? 1 : 0) - (wnd.kbd.KeyIsPressed(VK_LEFT) ? 1 : 0),
+		(wnd.kbd.KeyIsPressed(VK_DOWN) ? 1 : 0) - (wnd.kbd.KeyIsPressed(VK_UP) ? 1 : 0));
+	if (pan.x != 0 || pan.y != 0) endlessField.pan(pan);
+	endlessField.continueFlood();
+
+	if (endlessField.mineTriggered()) return;
+	if (!wnd.mouse.IsEmpty() && endlessField.mouseIsWithinField(wnd.mouse) == true)
+	{
+		const Mouse::Event ev = wnd.mouse.Read();
+		if (ev.GetType() == Mouse::Event::Type::LPress)
+		{
+			endlessField.revealTile(wnd.mouse.GetPos());
+		}
+		else if (ev.GetType() == Mouse::Event::Type::RPress)
+		{
+			endlessField.flagTile(wnd.mouse.GetPos());
+		}
+	}
+}
+
 void Game::ComposeFrame()
 {
+	if (isEndless)
+	{
+		endlessField.draw(gfx);
+		return;
+	}
+	if (!field.hasChanges()) return;
 	field.draw(gfx);
+	// THE WIN SCREEN COVERS TILES, SO IT IS DRAWN AGAIN WHENEVER ANY OF THEM WAS
 	if (field.allTilesRevealed()) SpriteCodex::DrawWin(Vei2(400, 150), gfx);
 }
@@ -24,6 +24,7 @@
 #include "Mouse.h"
 #include "Graphics.h"
 #include "MineField.h"
+#include "EndlessMineField.h"
 
 class Game
 {
@@ -37,6 +38,7 @@ private:
 	void UpdateModel();
 	/********************************/
 	/*  User Functions              */
+	void UpdateEndless();
 	/********************************/
 private:
 	MainWindow& wnd;
@@ -44,5 +46,9 @@ private:
 	/********************************/
 	/*  User Variables              */
 	MineField field;
+	EndlessMineField endlessField;
+	// TAB SWITCHES BETWEEN THE TWO FIELDS; EACH KEEPS ITS GAME
+	bool isEndless = false;
+	bool isFrameClearNeeded = false;
 	/********************************/
 };
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include "GameFarm.h"
+#include "Board.h"
+#include "SplitMix64.h"
+#include <assert.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    uint64_t packRange(uint64_t begin, uint64_t end)
+    {
+        return (begin << 32) | end;
+    }
+}
+
+GameFarm::GameFarm(int _width, int _height, int _nMines, Strategy _strategy, int _nThreads)
+    :width(_width), height(_height), nMines(_nMines), strategy(_strategy),
+    nThreads(_nThreads > 0 ? _nThreads : std::max(1, int(std::thread::hardware_concurrency()))),
+    ranges(new Range[nThreads]), results(_width, _height, _nMines, _strategy)
+{
+}
+
+void GameFarm::run(uint64_t seed, long long nGames)
+{
+    assert(nGames >= 0 && nGames <= 0xFFFFFFFFll);
+    workerResults.clear();
+    workerResults.reserve(nThreads);
+    results = Simulation(width, height, nMines, strategy);
+    for (int i = 0; i < nThreads; ++i)
+    {
+        workerResults.emplace_back(width, height, nMines, strategy);
+        ranges[i].bounds.store(packRange(uint64_t(nGames * i / nThreads), uint64_t(nGames * (i + 1) / nThreads)));
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 1; i < nThreads; ++i)
+    {
+        threads.emplace_back(&GameFarm::work, this, i, seed);
+    }
+    work(0, seed);
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    for (const WorkerResults& worker : workerResults)
+    {
+        results.merge(worker.simulation);
+    }
+}
+
+void GameFarm::work(int worker, uint64_t seed)
+{
+    WorkerResults& own = workerResults[worker];
+    Board board(width, height, nMines, seed);
+    do
+    {
+        const auto start = std::chrono::steady_clock::now();
+        long long game;
+        while (takeGame(worker, game))
+        {
+            const uint64_t gameSeed = SplitMix64::at(seed, uint64_t(game));
+            board.reset(gameSeed);
+            own.simulation.play(board, gameSeed);
+        }
+        own.busySeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (stealGames(worker));
+}
+
+bool GameFarm::takeGame(int worker, long long& game)
+{
+    std::atomic<uint64_t>& bounds = ranges[worker].bounds;
+    uint64_t range = bounds.load();
+    for (;;)
+    {
+        const uint64_t begin = range >> 32;
+        const uint64_t end = range & 0xFFFFFFFFu;
+        if (begin >= end) return false;
+        if (bounds.compare_exchange_weak(range, packRange(begin + 1, end)))
+        {
+            game = (long long)begin;
+            return true;
+        }
+    }
+}
+
+bool GameFarm::stealGames(int thief)
+{
+    // VISIT THE OTHER WORKERS STARTING WITH THE NEXT ONE, SO THIEVES SPREAD OVER DIFFERENT VICTIMS. THE THIEF'S
+    // OWN RANGE IS EMPTY, SO NOBODY ELSE WRITES IT UNTIL THE STOLEN GAMES ARE PUBLISHED THERE
+    for (int offset = 1; offset < nThreads; ++offset)
+    {
+        std::atomic<uint64_t>& bounds = ranges[(thief + offset) % nThreads].bounds;
+        uint64_t range = bounds.load();
+        for (;;)
+        {
+            const uint64_t begin = range >> 32;
+            const uint64_t end = range & 0xFFFFFFFFu;
+            if (begin >= end) break;
+            const uint64_t middle = end - (end - begin + 1) / 2;
+            if (bounds.compare_exchange_weak(range, packRange(begin, middle)))
+            {
+                ranges[thief].bounds.store(packRange(middle, end));
+                ++workerResults[thief].nSteals;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+const Simulation& GameFarm::getResults() const
+{
+    return results;
+}
+
+double GameFarm::getGamesPerSecond() const
+{
+    return wallSeconds > 0.0 ? results.getNumberOfGames() / wallSeconds : 0.0;
+}
+
+double GameFarm::getWorkerEfficiency(int worker) const
+{
+    assert(worker >= 0 && worker < int(workerResults.size()));
+    return wallSeconds > 0.0 ? workerResults[worker].busySeconds / wallSeconds : 0.0;
+}
+
+double GameFarm::getEfficiency() const
+{
+    double sum = 0.0;
+    for (int i = 0; i < int(workerResults.size()); ++i)
+    {
+        sum += getWorkerEfficiency(i);
+    }
+    return workerResults.empty() ? 0.0 : sum / workerResults.size();
+}
+
+long long GameFarm::getNumberOfSteals() const
+{
+    long long nSteals = 0;
+    for (const WorkerResults& worker : workerResults)
+    {
+        nSteals += worker.nSteals;
+    }
+    return nSteals;
+}
+
+int GameFarm::getNumberOfThreads() const
+{
+    return nThreads;
+}
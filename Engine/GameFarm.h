@@ -0,0 +1,57 @@
+#pragma once
+#include "Simulation.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// PLAYS MANY INDEPENDENT GAMES ACROSS WORKER THREADS. EVERY WORKER STARTS WITH AN EQUAL SHARE OF THE GAME
+// NUMBERS AS A RANGE IT TAKES GAMES FROM THE FRONT OF; A WORKER THAT RUNS OUT STEALS THE BACK HALF OF ANOTHER
+// WORKER'S RANGE. A RANGE IS ONE ATOMIC WORD, SO TAKING AND STEALING ARE SINGLE COMPARE-AND-SWAPS. EACH WORKER
+// REUSES ONE BOARD AND KEEPS ITS OWN RESULTS, WHICH ARE ONLY ADDED TOGETHER AFTER THE THREADS ARE JOINED
+class GameFarm
+{
+public:
+	// _nThreads == 0 USES EVERY HARDWARE THREAD
+	GameFarm(int _width, int _height, int _nMines, Strategy _strategy, int _nThreads = 0);
+	// PLAYS GAMES 0 TO nGames - 1, WHERE GAME i PLACES ITS MINES FROM SplitMix64::at(seed, i)
+	void run(uint64_t seed, long long nGames);
+	const Simulation& getResults() const;
+	double getGamesPerSecond() const;
+	// SHARE OF THE WALL TIME A WORKER SPENT PLAYING GAMES, RATHER THAN STEALING OR WAITING FOR THE OTHERS
+	double getWorkerEfficiency(int worker) const;
+	// AVERAGE OF THE WORKER EFFICIENCIES
+	double getEfficiency() const;
+	long long getNumberOfSteals() const;
+	int getNumberOfThreads() const;
+private:
+	// BEGIN IN THE HIGH 32 BITS, END IN THE LOW 32 BITS
+	struct alignas(64) Range
+	{
+		std::atomic<uint64_t> bounds{ 0 };
+	};
+	struct alignas(64) WorkerResults
+	{
+		WorkerResults(int width, int height, int nMines, Strategy strategy)
+			:simulation(width, height, nMines, strategy)
+		{
+		}
+		Simulation simulation;
+		double busySeconds = 0.0;
+		long long nSteals = 0;
+	};
+private:
+	void work(int worker, uint64_t seed);
+	bool takeGame(int worker, long long& game);
+	bool stealGames(int thief);
+private:
+	int width;
+	int height;
+	int nMines;
+	Strategy strategy;
+	int nThreads;
+	std::unique_ptr<Range[]> ranges;
+	std::vector<WorkerResults> workerResults;
+	Simulation results;
+	double wallSeconds = 0.0;
+};
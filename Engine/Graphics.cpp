@@ -18,226 +18,43 @@
 *	You should have received a copy of the GNU General Public License					  *
 *	along with The Chili DirectX Framework.  If not, see <http://www.gnu.org/licenses/>.  *
 ******************************************************************************************/
-#include "MainWindow.h"
 #include "Graphics.h"
-#include "DXErr.h"
-#include "ChiliException.h"
 #include <assert.h>
-#include <string>
-#include <array>
-
-// Ignore the intellisense error "cannot open source file" for .shh files.
-// They will be created during the build sequence before the preprocessor runs.
-namespace FramebufferShaders
-{
-#include "FramebufferPS.shh"
-#include "FramebufferVS.shh"
-}
-
-#pragma comment( lib,"d3d11.lib" )
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
 
-#define CHILI_GFX_EXCEPTION( hr,note ) Graphics::Exception( hr,note,_CRT_WIDE(__FILE__),__LINE__ )
+#ifdef _WIN32
+#include "MainWindow.h"
+#include "D3D11Backend.h"
+#endif
 
-using Microsoft::WRL::ComPtr;
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GRAPHICS_SSE2
+#include <emmintrin.h>
+#endif
 
+#ifdef _WIN32
 Graphics::Graphics( HWNDKey& key )
-{
-	assert( key.hWnd != nullptr );
-
-	//////////////////////////////////////////////////////
-	// create device and swap chain/get render target view
-	DXGI_SWAP_CHAIN_DESC sd = {};
-	sd.BufferCount = 1;
-	sd.BufferDesc.Width = Graphics::ScreenWidth;
-	sd.BufferDesc.Height = Graphics::ScreenHeight;
-	sd.BufferDesc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
-	sd.BufferDesc.RefreshRate.Numerator = 1;
-	sd.BufferDesc.RefreshRate.Denominator = 60;
-	sd.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
-	sd.OutputWindow = key.hWnd;
-	sd.SampleDesc.Count = 1;
-	sd.SampleDesc.Quality = 0;
-	sd.Windowed = TRUE;
-
-	HRESULT				hr;
-	UINT				createFlags = 0u;
-#ifdef CHILI_USE_D3D_DEBUG_LAYER
-#ifdef _DEBUG
-	createFlags |= D3D11_CREATE_DEVICE_DEBUG;
-#endif
+	:
+	Graphics( std::make_unique<D3D11Backend>( key,Graphics::ScreenWidth,Graphics::ScreenHeight ) )
+{}
 #endif
-	
-	// create device and front/back buffers
-	if( FAILED( hr = D3D11CreateDeviceAndSwapChain( 
-		nullptr,
-		D3D_DRIVER_TYPE_HARDWARE,
-		nullptr,
-		createFlags,
-		nullptr,
-		0,
-		D3D11_SDK_VERSION,
-		&sd,
-		&pSwapChain,
-		&pDevice,
-		nullptr,
-		&pImmediateContext ) ) )
-	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating device and swap chain" );
-	}
-
-	// get handle to backbuffer
-	ComPtr<ID3D11Resource> pBackBuffer;
-	if( FAILED( hr = pSwapChain->GetBuffer(
-		0,
-		__uuidof( ID3D11Texture2D ),
-		(LPVOID*)&pBackBuffer ) ) )
-	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Getting back buffer" );
-	}
-
-	// create a view on backbuffer that we can render to
-	if( FAILED( hr = pDevice->CreateRenderTargetView( 
-		pBackBuffer.Get(),
-		nullptr,
-		&pRenderTargetView ) ) )
-	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating render target view on backbuffer" );
-	}
-
-
-	// set backbuffer as the render target using created view
-	pImmediateContext->OMSetRenderTargets( 1,pRenderTargetView.GetAddressOf(),nullptr );
-
-
-	// set viewport dimensions
-	D3D11_VIEWPORT vp;
-	vp.Width = float( Graphics::ScreenWidth );
-	vp.Height = float( Graphics::ScreenHeight );
-	vp.MinDepth = 0.0f;
-	vp.MaxDepth = 1.0f;
-	vp.TopLeftX = 0.0f;
-	vp.TopLeftY = 0.0f;
-	pImmediateContext->RSSetViewports( 1,&vp );
-
-
-	///////////////////////////////////////
-	// create texture for cpu render target
-	D3D11_TEXTURE2D_DESC sysTexDesc;
-	sysTexDesc.Width = Graphics::ScreenWidth;
-	sysTexDesc.Height = Graphics::ScreenHeight;
-	sysTexDesc.MipLevels = 1;
-	sysTexDesc.ArraySize = 1;
-	sysTexDesc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
-	sysTexDesc.SampleDesc.Count = 1;
-	sysTexDesc.SampleDesc.Quality = 0;
-	sysTexDesc.Usage = D3D11_USAGE_DYNAMIC;
-	sysTexDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-	sysTexDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-	sysTexDesc.MiscFlags = 0;
-	// create the texture
-	if( FAILED( hr = pDevice->CreateTexture2D( &sysTexDesc,nullptr,&pSysBufferTexture ) ) )
-	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating sysbuffer texture" );
-	}
-
-	D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-	srvDesc.Format = sysTexDesc.Format;
-	srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
-	srvDesc.Texture2D.MipLevels = 1;
-	// create the resource view on the texture
-	if( FAILED( hr = pDevice->CreateShaderResourceView( pSysBufferTexture.Get(),
-		&srvDesc,&pSysBufferTextureView ) ) )
-	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating view on sysBuffer texture" );
-	}
-
-
-	////////////////////////////////////////////////
-	// create pixel shader for framebuffer
-	// Ignore the intellisense error "namespace has no member"
-	if( FAILED( hr = pDevice->CreatePixelShader(
-		FramebufferShaders::FramebufferPSBytecode,
-		sizeof( FramebufferShaders::FramebufferPSBytecode ),
-		nullptr,
-		&pPixelShader ) ) )
-	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating pixel shader" );
-	}
-	
-
-	/////////////////////////////////////////////////
-	// create vertex shader for framebuffer
-	// Ignore the intellisense error "namespace has no member"
-	if( FAILED( hr = pDevice->CreateVertexShader(
-		FramebufferShaders::FramebufferVSBytecode,
-		sizeof( FramebufferShaders::FramebufferVSBytecode ),
-		nullptr,
-		&pVertexShader ) ) )
-	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating vertex shader" );
-	}
-	
-
-	//////////////////////////////////////////////////////////////
-	// create and fill vertex buffer with quad for rendering frame
-	const FSQVertex vertices[] =
-	{
-		{ -1.0f,1.0f,0.5f,0.0f,0.0f },
-		{ 1.0f,1.0f,0.5f,1.0f,0.0f },
-		{ 1.0f,-1.0f,0.5f,1.0f,1.0f },
-		{ -1.0f,1.0f,0.5f,0.0f,0.0f },
-		{ 1.0f,-1.0f,0.5f,1.0f,1.0f },
-		{ -1.0f,-1.0f,0.5f,0.0f,1.0f },
-	};
-	D3D11_BUFFER_DESC bd = {};
-	bd.Usage = D3D11_USAGE_DEFAULT;
-	bd.ByteWidth = sizeof( FSQVertex ) * 6;
-	bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-	bd.CPUAccessFlags = 0u;
-	D3D11_SUBRESOURCE_DATA initData = {};
-	initData.pSysMem = vertices;
-	if( FAILED( hr = pDevice->CreateBuffer( &bd,&initData,&pVertexBuffer ) ) )
-	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating vertex buffer" );
-	}
-
-	
-	//////////////////////////////////////////
-	// create input layout for fullscreen quad
-	const D3D11_INPUT_ELEMENT_DESC ied[] =
-	{
-		{ "POSITION",0,DXGI_FORMAT_R32G32B32_FLOAT,0,0,D3D11_INPUT_PER_VERTEX_DATA,0 },
-		{ "TEXCOORD",0,DXGI_FORMAT_R32G32_FLOAT,0,12,D3D11_INPUT_PER_VERTEX_DATA,0 }
-	};
-
-	// Ignore the intellisense error "namespace has no member"
-	if( FAILED( hr = pDevice->CreateInputLayout( ied,2,
-		FramebufferShaders::FramebufferVSBytecode,
-		sizeof( FramebufferShaders::FramebufferVSBytecode ),
-		&pInputLayout ) ) )
-	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating input layout" );
-	}
-
-
-	////////////////////////////////////////////////////
-	// Create sampler state for fullscreen textured quad
-	D3D11_SAMPLER_DESC sampDesc = {};
-	sampDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_POINT;
-	sampDesc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
-	sampDesc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
-	sampDesc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
-	sampDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
-	sampDesc.MinLOD = 0;
-	sampDesc.MaxLOD = D3D11_FLOAT32_MAX;
-	if( FAILED( hr = pDevice->CreateSamplerState( &sampDesc,&pSamplerState ) ) )
-	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Creating sampler state" );
-	}
 
+Graphics::Graphics( std::unique_ptr<GraphicsBackend> pBackend )
+	:
+	pBackend( std::move( pBackend ) )
+{
+	assert( this->pBackend );
 	// allocate memory for sysbuffer (16-byte aligned for faster access)
-	pSysBuffer = reinterpret_cast<Color*>( 
-		_aligned_malloc( sizeof( Color ) * Graphics::ScreenWidth * Graphics::ScreenHeight,16u ) );
+	const size_t sysBufferBytes = sizeof( Color ) * Graphics::ScreenWidth * Graphics::ScreenHeight;
+#ifdef _WIN32
+	pSysBuffer = reinterpret_cast<Color*>( _aligned_malloc( sysBufferBytes,16u ) );
+#else
+	pSysBuffer = reinterpret_cast<Color*>( aligned_alloc( 16u,sysBufferBytes ) );
+#endif
+	// start black, so retained frames never draw over garbage
+	memset( static_cast<void*>( pSysBuffer ),0,sysBufferBytes );
 }
 
 Graphics::~Graphics()
@@ -245,66 +62,31 @@ Graphics::~Graphics()
 	// free sysbuffer memory (aligned free)
 	if( pSysBuffer )
 	{
+#ifdef _WIN32
 		_aligned_free( pSysBuffer );
+#else
+		free( pSysBuffer );
+#endif
 		pSysBuffer = nullptr;
 	}
-	// clear the state of the device context before destruction
-	if( pImmediateContext ) pImmediateContext->ClearState();
 }
 
 void Graphics::EndFrame()
 {
-	HRESULT hr;
-
-	// lock and map the adapter memory for copying over the sysbuffer
-	if( FAILED( hr = pImmediateContext->Map( pSysBufferTexture.Get(),0u,
-		D3D11_MAP_WRITE_DISCARD,0u,&mappedSysBufferTexture ) ) )
-	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Mapping sysbuffer" );
-	}
-	// setup parameters for copy operation
-	Color* pDst = reinterpret_cast<Color*>(mappedSysBufferTexture.pData );
-	const size_t dstPitch = mappedSysBufferTexture.RowPitch / sizeof( Color );
-	const size_t srcPitch = Graphics::ScreenWidth;
-	const size_t rowBytes = srcPitch * sizeof( Color );
-	// perform the copy line-by-line
-	for( size_t y = 0u; y < Graphics::ScreenHeight; y++ )
-	{
-		memcpy( &pDst[ y * dstPitch ],&pSysBuffer[y * srcPitch],rowBytes );
-	}
-	// release the adapter memory
-	pImmediateContext->Unmap( pSysBufferTexture.Get(),0u );
-
-	// render offscreen scene texture to back buffer
-	pImmediateContext->IASetInputLayout( pInputLayout.Get() );
-	pImmediateContext->VSSetShader( pVertexShader.Get(),nullptr,0u );
-	pImmediateContext->PSSetShader( pPixelShader.Get(),nullptr,0u );
-	pImmediateContext->IASetPrimitiveTopology( D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST );
-	const UINT stride = sizeof( FSQVertex );
-	const UINT offset = 0u;
-	pImmediateContext->IASetVertexBuffers( 0u,1u,pVertexBuffer.GetAddressOf(),&stride,&offset );
-	pImmediateContext->PSSetShaderResources( 0u,1u,pSysBufferTextureView.GetAddressOf() );
-	pImmediateContext->PSSetSamplers( 0u,1u,pSamplerState.GetAddressOf() );
-	pImmediateContext->Draw( 6u,0u );
-
-	// flip back/front buffers
-	if( FAILED( hr = pSwapChain->Present( 1u,0u ) ) )
-	{
-		if( hr == DXGI_ERROR_DEVICE_REMOVED )
-		{
-			throw CHILI_GFX_EXCEPTION( pDevice->GetDeviceRemovedReason(),L"Presenting back buffer [device removed]" );
-		}
-		else
-		{
-			throw CHILI_GFX_EXCEPTION( hr,L"Presenting back buffer" );
-		}
-	}
+	pBackend->Present( pSysBuffer,Graphics::ScreenWidth,Graphics::ScreenHeight,isSysBufferChanged );
 }
 
 void Graphics::BeginFrame()
 {
 	// clear the sysbuffer
-	memset( pSysBuffer,0u,sizeof( Color ) * Graphics::ScreenHeight * Graphics::ScreenWidth );
+	memset( static_cast<void*>( pSysBuffer ),0,sizeof( Color ) * Graphics::ScreenHeight * Graphics::ScreenWidth );
+	isSysBufferChanged = true;
+}
+
+void Graphics::BeginRetainedFrame( bool hasChanges )
+{
+	// the sysbuffer keeps its pixels and the backend is told whether they changed
+	isSysBufferChanged = hasChanges;
 }
 
 void Graphics::PutPixel( int x,int y,Color c )
@@ -327,45 +109,71 @@ void Graphics::DrawRect( int x0,int y0,int x1,int y1,Color c )
 	}
 }
 
-
-//////////////////////////////////////////////////
-//           Graphics Exception
-Graphics::Exception::Exception( HRESULT hr,const std::wstring& note,const wchar_t* file,unsigned int line )
-	:
-	ChiliException( file,line,note ),
-	hr( hr )
-{}
-
-std::wstring Graphics::Exception::GetFullMessage() const
+void Graphics::DrawSprite( int x,int y,const Color* pSrc,int srcPitch,int width,int height,Color chroma )
 {
-	const std::wstring empty = L"";
-	const std::wstring errorName = GetErrorName();
-	const std::wstring errorDesc = GetErrorDescription();
-	const std::wstring& note = GetNote();
-	const std::wstring location = GetLocation();
-	return    (!errorName.empty() ? std::wstring( L"Error: " ) + errorName + L"\n"
-		: empty)
-		+ (!errorDesc.empty() ? std::wstring( L"Description: " ) + errorDesc + L"\n"
-			: empty)
-		+ (!note.empty() ? std::wstring( L"Note: " ) + note + L"\n"
-			: empty)
-		+ (!location.empty() ? std::wstring( L"Location: " ) + location
-			: empty);
+	// clip the block to the screen
+	const int left = std::max( 0,-x );
+	const int top = std::max( 0,-y );
+	const int right = std::min( width,int( Graphics::ScreenWidth ) - x );
+	const int bottom = std::min( height,int( Graphics::ScreenHeight ) - y );
+#ifdef GRAPHICS_SSE2
+	const __m128i key = _mm_set1_epi32( int( chroma.dword ) );
+#endif
+	for( int sy = top; sy < bottom; ++sy )
+	{
+		const Color* pSrcRow = pSrc + size_t( srcPitch ) * sy;
+		Color* pDstRow = pSysBuffer + size_t( Graphics::ScreenWidth ) * (y + sy) + x;
+		int sx = left;
+#ifdef GRAPHICS_SSE2
+		// four pixels at a time: keep the destination where the source is chroma
+		for( ; sx + 4 <= right; sx += 4 )
+		{
+			const __m128i src = _mm_loadu_si128( reinterpret_cast<const __m128i*>(pSrcRow + sx) );
+			const __m128i dst = _mm_loadu_si128( reinterpret_cast<const __m128i*>(pDstRow + sx) );
+			const __m128i isKey = _mm_cmpeq_epi32( src,key );
+			_mm_storeu_si128( reinterpret_cast<__m128i*>(pDstRow + sx),
+				_mm_or_si128( _mm_and_si128( isKey,dst ),_mm_andnot_si128( isKey,src ) ) );
+		}
+#endif
+		for( ; sx < right; ++sx )
+		{
+			if( pSrcRow[sx].dword != chroma.dword )
+			{
+				pDstRow[sx] = pSrcRow[sx];
+			}
+		}
+	}
 }
 
-std::wstring Graphics::Exception::GetErrorName() const
+void Graphics::DrawSprite( int x,int y,const RleSprite& sprite )
 {
-	return DXGetErrorString( hr );
+	sprite.draw( pSysBuffer,Graphics::ScreenWidth,Graphics::ScreenWidth,Graphics::ScreenHeight,x,y );
 }
 
-std::wstring Graphics::Exception::GetErrorDescription() const
+void Graphics::DrawTileRow( int x,int y,int size,const Color* const* ppTiles,int nTiles )
 {
-	std::array<wchar_t,512> wideDescription;
-	DXGetErrorDescription( hr,wideDescription.data(),wideDescription.size() );
-	return wideDescription.data();
+	assert( size % 4 == 0 );
+	assert( x >= 0 );
+	assert( x + size * nTiles <= int( Graphics::ScreenWidth ) );
+	assert( y >= 0 );
+	assert( y + size <= int( Graphics::ScreenHeight ) );
+	// one screen row at a time, so the writes stream through the sysbuffer
+	for( int ty = 0; ty < size; ++ty )
+	{
+		Color* pDst = pSysBuffer + size_t( Graphics::ScreenWidth ) * (y + ty) + x;
+		for( int i = 0; i < nTiles; ++i,pDst += size )
+		{
+			const Color* const pSrc = ppTiles[i] + size_t( size ) * ty;
+#ifdef GRAPHICS_SSE2
+			for( int tx = 0; tx < size; tx += 4 )
+			{
+				_mm_storeu_si128( reinterpret_cast<__m128i*>(pDst + tx),
+					_mm_load_si128( reinterpret_cast<const __m128i*>(pSrc + tx) ) );
+			}
+#else
+			memcpy( pDst,pSrc,sizeof( Color ) * size );
+#endif
+		}
+	}
 }
 
-std::wstring Graphics::Exception::GetExceptionType() const
-{
-	return L"Chili Graphics Exception";
-}
\ No newline at end of file
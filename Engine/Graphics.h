@@ -19,43 +19,30 @@
 *	along with The Chili DirectX Framework.  If not, see <http://www.gnu.org/licenses/>.  *
 ******************************************************************************************/
 #pragma once
-#include "ChiliWin.h"
-#include <d3d11.h>
-#include <wrl.h>
-#include "ChiliException.h"
 #include "Colors.h"
 #include "RectI.h"
+#include "RleSprite.h"
+#include "GraphicsBackend.h"
+#include <memory>
 
 class Graphics
 {
 public:
-	class Exception : public ChiliException
-	{
-	public:
-		Exception( HRESULT hr,const std::wstring& note,const wchar_t* file,unsigned int line );
-		std::wstring GetErrorName() const;
-		std::wstring GetErrorDescription() const;
-		virtual std::wstring GetFullMessage() const override;
-		virtual std::wstring GetExceptionType() const override;
-	private:
-		HRESULT hr;
-	};
-private:
-	// vertex format for the framebuffer fullscreen textured quad
-	struct FSQVertex
-	{
-		float x,y,z;		// position
-		float u,v;			// texcoords
-	};
-public:
+#ifdef _WIN32
+	// presents the frames in the window, through d3d11
 	Graphics( class HWNDKey& key );
+#endif
+	explicit Graphics( std::unique_ptr<GraphicsBackend> pBackend );
 	Graphics( const Graphics& ) = delete;
 	Graphics& operator=( const Graphics& ) = delete;
 	void EndFrame();
 	void BeginFrame();
+	// starts a frame drawn over the previous one instead of a cleared sysbuffer; unless hasChanges, EndFrame
+	// presents the previous frame again without uploading the sysbuffer
+	void BeginRetainedFrame( bool hasChanges );
 	void PutPixel( int x,int y,int r,int g,int b )
 	{
-		PutPixel( x,y,{ unsigned char( r ),unsigned char( g ),unsigned char( b ) } );
+		PutPixel( x,y,{ (unsigned char)r,(unsigned char)g,(unsigned char)b } );
 	}
 	void PutPixel( int x,int y,Color c );
 	void DrawRect( int x0,int y0,int x1,int y1,Color c );
@@ -63,21 +50,18 @@ public:
 	{
 		DrawRect( rect.left,rect.top,rect.right,rect.bottom,c );
 	}
+	// copies a width x height block of pixels (srcPitch pixels apart from row to row) with its top left at x,y,
+	// skipping the pixels equal to chroma; clipped to the screen
+	void DrawSprite( int x,int y,const Color* pSrc,int srcPitch,int width,int height,Color chroma );
+	void DrawSprite( int x,int y,const RleSprite& sprite );
+	// copies nTiles opaque size x size blocks side by side, left to right from x,y; block i is stored row by row
+	// at ppTiles[i], 16-byte aligned, and size must be a multiple of 4. the row must lie on the screen
+	void DrawTileRow( int x,int y,int size,const Color* const* ppTiles,int nTiles );
 	~Graphics();
 private:
-	Microsoft::WRL::ComPtr<IDXGISwapChain>				pSwapChain;
-	Microsoft::WRL::ComPtr<ID3D11Device>				pDevice;
-	Microsoft::WRL::ComPtr<ID3D11DeviceContext>			pImmediateContext;
-	Microsoft::WRL::ComPtr<ID3D11RenderTargetView>		pRenderTargetView;
-	Microsoft::WRL::ComPtr<ID3D11Texture2D>				pSysBufferTexture;
-	Microsoft::WRL::ComPtr<ID3D11ShaderResourceView>	pSysBufferTextureView;
-	Microsoft::WRL::ComPtr<ID3D11PixelShader>			pPixelShader;
-	Microsoft::WRL::ComPtr<ID3D11VertexShader>			pVertexShader;
-	Microsoft::WRL::ComPtr<ID3D11Buffer>				pVertexBuffer;
-	Microsoft::WRL::ComPtr<ID3D11InputLayout>			pInputLayout;
-	Microsoft::WRL::ComPtr<ID3D11SamplerState>			pSamplerState;
-	D3D11_MAPPED_SUBRESOURCE							mappedSysBufferTexture;
+	std::unique_ptr<GraphicsBackend>					pBackend;
 	Color*                                              pSysBuffer = nullptr;
+	bool												isSysBufferChanged = true;
 public:
 	static constexpr int ScreenWidth = 800;
 	static constexpr int ScreenHeight = 600;
@@ -0,0 +1,13 @@
+#pragma once
+#include "Colors.h"
+
+// where Graphics presents its frames: the d3d11 backend shows them in the window, the headless one keeps them
+// off screen (optionally writing them to image files), so the cpu rendering also runs on machines without a gpu
+class GraphicsBackend
+{
+public:
+	virtual ~GraphicsBackend() = default;
+	// called once per frame with the width x height pixels of the sysbuffer, row by row; unless isChanged they
+	// are the same as in the last call
+	virtual void Present( const Color* pSysBuffer,int width,int height,bool isChanged ) = 0;
+};
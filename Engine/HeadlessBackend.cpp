@@ -0,0 +1,184 @@
+#include "HeadlessBackend.h"
+#include <stdio.h>
+#include <algorithm>
+#include <array>
+#include <fstream>
+
+#define HEADLESS_WIDEN2( text ) L ## text
+#define HEADLESS_WIDEN( text ) HEADLESS_WIDEN2( text )
+#define CHILI_HEADLESS_EXCEPTION( note ) HeadlessBackend::Exception( HEADLESS_WIDEN( __FILE__ ),__LINE__,note )
+
+namespace
+{
+	// crc-32 (iso 3309) as png wants it, on a table built on first use
+	unsigned int UpdateCrc( unsigned int crc,const unsigned char* pData,size_t size )
+	{
+		static const std::array<unsigned int,256> table = []()
+		{
+			std::array<unsigned int,256> t;
+			for( unsigned int n = 0u; n < 256u; n++ )
+			{
+				unsigned int c = n;
+				for( int k = 0; k < 8; k++ )
+				{
+					c = (c & 1u) ? 0xEDB88320u ^ (c >> 1u) : c >> 1u;
+				}
+				t[n] = c;
+			}
+			return t;
+		}();
+		for( size_t i = 0u; i < size; i++ )
+		{
+			crc = table[(crc ^ pData[i]) & 0xFFu] ^ (crc >> 8u);
+		}
+		return crc;
+	}
+
+	void AppendBigEndian( std::vector<unsigned char>& bytes,unsigned int value )
+	{
+		bytes.push_back( (unsigned char)(value >> 24u) );
+		bytes.push_back( (unsigned char)(value >> 16u) );
+		bytes.push_back( (unsigned char)(value >> 8u) );
+		bytes.push_back( (unsigned char)value );
+	}
+}
+
+HeadlessBackend::HeadlessBackend( Output output,const std::string& pathPrefix )
+	:
+	output( output ),
+	pathPrefix( pathPrefix )
+{}
+
+void HeadlessBackend::Present( const Color* pSysBuffer,int width,int height,bool isChanged )
+{
+	const int frame = frameCount++;
+	if( output == Output::None || (!isChanged && frame > 0) )
+	{
+		return;
+	}
+	if( output == Output::Ppm )
+	{
+		EncodePpm( pSysBuffer,width,height );
+	}
+	else
+	{
+		EncodePng( pSysBuffer,width,height );
+	}
+
+	char number[16];
+	snprintf( number,sizeof( number ),"%06d",frame );
+	const std::string path = pathPrefix + number + (output == Output::Ppm ? ".ppm" : ".png");
+	std::ofstream file( path,std::ios::binary );
+	if( !file )
+	{
+		throw CHILI_HEADLESS_EXCEPTION( L"Opening " + std::wstring( path.begin(),path.end() ) );
+	}
+	file.write( reinterpret_cast<const char*>( fileBytes.data() ),std::streamsize( fileBytes.size() ) );
+	file.close();
+	if( !file )
+	{
+		throw CHILI_HEADLESS_EXCEPTION( L"Writing " + std::wstring( path.begin(),path.end() ) );
+	}
+}
+
+int HeadlessBackend::GetFrameCount() const
+{
+	return frameCount;
+}
+
+void HeadlessBackend::EncodePpm( const Color* pPixels,int width,int height )
+{
+	char header[32];
+	const int headerSize = snprintf( header,sizeof( header ),"P6\n%d %d\n255\n",width,height );
+	fileBytes.assign( header,header + headerSize );
+	fileBytes.resize( size_t( headerSize ) + size_t( width ) * height * 3u );
+	unsigned char* pDst = fileBytes.data() + headerSize;
+	for( size_t i = 0u; i < size_t( width ) * height; i++ )
+	{
+		*pDst++ = pPixels[i].GetR();
+		*pDst++ = pPixels[i].GetG();
+		*pDst++ = pPixels[i].GetB();
+	}
+}
+
+void HeadlessBackend::EncodePng( const Color* pPixels,int width,int height )
+{
+	// the image rows, each one starting with its filter type (0, none)
+	const size_t rowBytes = 1u + size_t( width ) * 3u;
+	pngRows.resize( rowBytes * height );
+	for( int y = 0; y < height; y++ )
+	{
+		unsigned char* pDst = &pngRows[rowBytes * y];
+		*pDst++ = 0u;
+		const Color* pSrc = pPixels + size_t( width ) * y;
+		for( int x = 0; x < width; x++ )
+		{
+			*pDst++ = pSrc[x].GetR();
+			*pDst++ = pSrc[x].GetG();
+			*pDst++ = pSrc[x].GetB();
+		}
+	}
+
+	static const unsigned char signature[] = { 137u,'P','N','G','\r','\n',26u,'\n' };
+	fileBytes.assign( std::begin( signature ),std::end( signature ) );
+
+	// 8 bits per channel, rgb, default compression, filtering and no interlace
+	const unsigned char header[] =
+	{
+		(unsigned char)(width >> 24),(unsigned char)(width >> 16),(unsigned char)(width >> 8),(unsigned char)width,
+		(unsigned char)(height >> 24),(unsigned char)(height >> 16),(unsigned char)(height >> 8),(unsigned char)height,
+		8u,2u,0u,0u,0u
+	};
+	AppendPngChunk( "IHDR",header,sizeof( header ) );
+
+	// a zlib stream of stored deflate blocks of at most 65535 bytes each, then the adler-32 of the rows
+	constexpr size_t maxBlockBytes = 65535u;
+	pngData.clear();
+	pngData.push_back( 0x78u );
+	pngData.push_back( 0x01u );
+	size_t offset = 0u;
+	do
+	{
+		const size_t blockBytes = std::min( maxBlockBytes,pngRows.size() - offset );
+		const bool isFinal = offset + blockBytes == pngRows.size();
+		pngData.push_back( isFinal ? 1u : 0u );
+		pngData.push_back( (unsigned char)blockBytes );
+		pngData.push_back( (unsigned char)(blockBytes >> 8u) );
+		pngData.push_back( (unsigned char)~blockBytes );
+		pngData.push_back( (unsigned char)(~blockBytes >> 8u) );
+		pngData.insert( pngData.end(),pngRows.begin() + offset,pngRows.begin() + offset + blockBytes );
+		offset += blockBytes;
+	}
+	while( offset < pngRows.size() );
+	unsigned int a = 1u;
+	unsigned int b = 0u;
+	// 5552 bytes is the most that can be summed before b could overflow
+	for( size_t start = 0u; start < pngRows.size(); start += 5552u )
+	{
+		const size_t end = std::min( start + 5552u,pngRows.size() );
+		for( size_t i = start; i < end; i++ )
+		{
+			a += pngRows[i];
+			b += a;
+		}
+		a %= 65521u;
+		b %= 65521u;
+	}
+	AppendBigEndian( pngData,(b << 16u) | a );
+	AppendPngChunk( "IDAT",pngData.data(),pngData.size() );
+
+	AppendPngChunk( "IEND",nullptr,0u );
+}
+
+void HeadlessBackend::AppendPngChunk( const char* type,const unsigned char* pData,size_t size )
+{
+	AppendBigEndian( fileBytes,(unsigned int)size );
+	const size_t typeOffset = fileBytes.size();
+	fileBytes.insert( fileBytes.end(),type,type + 4 );
+	if( size > 0u )
+	{
+		fileBytes.insert( fileBytes.end(),pData,pData + size );
+	}
+	const unsigned int crc = UpdateCrc( 0xFFFFFFFFu,&fileBytes[typeOffset],4u + size ) ^ 0xFFFFFFFFu;
+	AppendBigEndian( fileBytes,crc );
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include "GraphicsBackend.h"
+#include "ChiliException.h"
+#include <string>
+#include <vector>
+
+// keeps the frames off screen: drops them, or writes every changed one to an image file. needs no window and no
+// gpu, so the cpu rendering can be benchmarked and golden-image tested on any machine
+class HeadlessBackend : public GraphicsBackend
+{
+public:
+	class Exception : public ChiliException
+	{
+	public:
+		using ChiliException::ChiliException;
+		virtual std::wstring GetFullMessage() const override { return GetNote() + L"\nAt: " + GetLocation(); }
+		virtual std::wstring GetExceptionType() const override { return L"Headless Backend Exception"; }
+	};
+	enum class Output
+	{
+		None,
+		// binary ppm (p6)
+		Ppm,
+		// png with stored (uncompressed) deflate blocks, so no zlib is needed
+		Png
+	};
+public:
+	// frame n goes to pathPrefix followed by n (zero padded to 6 digits) and the extension. a frame that did not
+	// change is not written again, so a missing number means the frame looks like the one before it
+	HeadlessBackend( Output output = Output::None,const std::string& pathPrefix = "frame" );
+	void Present( const Color* pSysBuffer,int width,int height,bool isChanged ) override;
+	int GetFrameCount() const;
+private:
+	void EncodePpm( const Color* pPixels,int width,int height );
+	void EncodePng( const Color* pPixels,int width,int height );
+	void AppendPngChunk( const char* type,const unsigned char* pData,size_t size );
+private:
+	Output output;
+	std::string pathPrefix;
+	int frameCount = 0;
+	// the encoded file, kept between frames so encoding does not allocate once it has grown
+	std::vector<unsigned char> fileBytes;
+	std::vector<unsigned char> pngRows;
+	std::vector<unsigned char> pngData;
+};
@@ -0,0 +1,33 @@
+#pragma once
+#include <assert.h>
+#include <cmath>
+
+// LOG OF n!, SUMMED DIRECTLY FOR SMALL n AND FROM THE STIRLING SERIES ABOVE THAT (ACCURATE TO ABOUT 1e-14).
+// std::lgamma WOULD DO, BUT IT WRITES THE GLOBAL signgam ON POSIX SYSTEMS AND SO IS NOT SAFE TO CALL FROM
+// SEVERAL THREADS AT ONCE
+inline double logFactorial(int n)
+{
+	assert(n >= 0);
+	if (n < 16)
+	{
+		double sum = 0.0;
+		for (int i = 2; i <= n; ++i)
+		{
+			sum += std::log(double(i));
+		}
+		return sum;
+	}
+	const double x = double(n);
+	const double inverse = 1.0 / x;
+	const double inverseSquared = inverse * inverse;
+	return x * std::log(x) - x + 0.5 * std::log(2.0 * 3.14159265358979323846 * x)
+		+ inverse * (1.0 / 12.0 - inverseSquared * (1.0 / 360.0 - inverseSquared * (1.0 / 1260.0
+		- inverseSquared * (1.0 / 1680.0))));
+}
+
+// LOG OF THE BINOMIAL COEFFICIENT C(n, k), FOR 0 <= k <= n
+inline double logBinomial(int n, int k)
+{
+	assert(k >= 0 && k <= n);
+	return logFactorial(n) - logFactorial(k) - logFactorial(n - k);
+}
@@ -26,10 +26,10 @@
 #include "ChiliException.h"
 #include <string>
 
-// for granting special access to hWnd only for Graphics constructor
+// for granting special access to hWnd only for the d3d11 graphics backend
 class HWNDKey
 {
-	friend Graphics::Graphics( HWNDKey& );
+	friend class D3D11Backend;
 public:
 	HWNDKey( const HWNDKey& ) = delete;
 	HWNDKey& operator=( HWNDKey& ) = delete;
@@ -1,265 +1,221 @@
 #include "MineField.h"
-#include <random>
+#include "NoGuessGenerator.h"
 #include <assert.h>
 #include <algorithm>
+#include <random>
 
-MineField::MineField(int _nMines)
-    :nMines(_nMines), isMineTriggered(false), nRevealedSafeTiles(0)
+namespace
 {
-    assert(_nMines > 0 && _nMines < (TILES_PER_WIDTH * TILES_PER_HEIGHT));
+    // SHOWS THROUGH THE PARTS OF A TILE ITS SPRITES LEAVE UNDRAWN, SO THE CACHED TILES ARE COMPOSED OVER IT
+    constexpr Color BACKGROUND_COLOR = Colors::White;
 
-    int boundaryRight = MARGIN_LEFT + (TILES_PER_WIDTH * SpriteCodex::tileSize);
-    int boundaryBottom = MARGIN_TOP + (TILES_PER_HEIGHT * SpriteCodex::tileSize);
-    boundary = RectI(Vei2(MARGIN_LEFT, MARGIN_TOP), Vei2(boundaryRight, boundaryBottom));
+    // THE FIRST REVEAL RUNS THE NO-GUESS SEARCH ON THE FRAME LOOP, SO IT ONLY GETS A FEW CANDIDATES: AN EXPERT
+    // FIELD NEEDS ABOUT 10 ON AVERAGE AND A CORE PLAYS A FEW THOUSAND A SECOND
+    constexpr long long NO_GUESS_MAX_CANDIDATES = 256;
 
-    for (int y = 0; y < TILES_PER_HEIGHT; ++y)
+    RectI clipRect(const RectI& rect, const RectI& clip)
     {
-        for (int x = 0; x < TILES_PER_WIDTH; ++x)
-        {
-            tileAt({x, y}) = Tile({x, y});
-        }
+        return RectI(std::max(rect.left, clip.left), std::min(rect.right, clip.right),
+            std::max(rect.top, clip.top), std::min(rect.bottom, clip.bottom));
     }
 
-    std::random_device rd;
-    std::mt19937 rng(rd());
-    std::uniform_int_distribution<int> xDist(0, TILES_PER_WIDTH - 1);
-    std::uniform_int_distribution<int> yDist(0, TILES_PER_HEIGHT - 1);
-
-	for (int i = 0; i < nMines; ++i)
-	{
-		Vei2 gridPos = { 0,0 };
-		do {
-			gridPos = { xDist(rng), yDist(rng) };
-		} while (tileAt(gridPos).hasMine);
-		tileAt(gridPos).spawnMine();
-	}
-
-    for (int y = 0; y < TILES_PER_HEIGHT; ++y)
+    uint64_t randomSeed()
     {
-        for (int x = 0; x < TILES_PER_WIDTH; ++x)
-        {
-            Tile& tile{ tileAt({ x, y }) };
-            tile.setNumberOfAdjacentMines(getNumberOfAdjacentMines(tile));
-        }
+        std::random_device rd;
+        return (uint64_t(rd()) << 32) | rd();
     }
 }
 
-MineField::Tile::Tile(const Vei2& pos)
-    :gridPos(pos), state(State::Hidden), hasMine(false)
+MineField::MineField(int width, int height, int nMines, Generation _generation)
+    :MineField(width, height, nMines, randomSeed(), _generation)
 {
 }
 
-void MineField::Tile::draw(Graphics& gfx, bool mineTriggered)
+MineField::MineField(int width, int height, int nMines, uint64_t seed, Generation _generation)
+    :generation(_generation), board(width, height, nMines, seed), moveLog(width, height, nMines, seed),
+    changedTiles(width, height), tileCache(BACKGROUND_COLOR)
 {
-    // ADD THE MARGIN OFFSET TO ALL PIXELS TO BE DRAWN
-    Vei2 pixelPos = gridToPixelPosition(gridPos);
-    pixelPos += Vei2(MARGIN_LEFT, MARGIN_TOP);
-    if (mineTriggered)
+    marginLeft = (Graphics::ScreenWidth / 2) - ((width * SpriteCodex::tileSize) / 2);
+    marginTop = (Graphics::ScreenHeight / 2) - ((height * SpriteCodex::tileSize) / 2);
+    int boundaryRight = marginLeft + (width * SpriteCodex::tileSize);
+    int boundaryBottom = marginTop + (height * SpriteCodex::tileSize);
+    boundary = RectI(Vei2(marginLeft, marginTop), Vei2(boundaryRight, boundaryBottom));
+}
+
+const Color* MineField::getTileLook(const Vei2& gridPos) const
+{
+    TileCache::State state = TileCache::State::Hidden;
+    int number = 0;
+    if (board.isRevealed(gridPos))
     {
-        switch (state)
-        {
-        case MineField::Tile::State::Revealed:
+        state = TileCache::State::Revealed;
+        number = board.getNumberOfAdjacentMines(gridPos);
+    }
+    else if (board.isFlagged(gridPos))
+    {
+        state = TileCache::State::Flagged;
+    }
+    if (board.hasMine(gridPos)) number = TileCache::MINE;
+    return tileCache.getTile(state, number, board.mineTriggered());
+}
+
+void MineField::draw(Graphics& gfx)
+{
+    // CLIP THE BORDERS AND THE TILE RANGE TO THE SCREEN SO LARGE FIELDS ONLY COST WHAT IS VISIBLE
+    const int tileSize = SpriteCodex::tileSize;
+    const int xStart = std::max(0, (tileSize - 1 - marginLeft) / tileSize);
+    const int xEnd = std::min(board.getWidth(), (Graphics::ScreenWidth - marginLeft) / tileSize);
+    const int yStart = std::max(0, (tileSize - 1 - marginTop) / tileSize);
+    const int yEnd = std::min(board.getHeight(), (Graphics::ScreenHeight - marginTop) / tileSize);
+    if (isFullRedrawNeeded)
+    {
+        const RectI screen(0, Graphics::ScreenWidth, 0, Graphics::ScreenHeight);
+        const RectI border = boundary.GetExpanded(BORDER_WIDTH);
+        gfx.DrawRect(clipRect(RectI(border.left, border.right, border.top, boundary.top), screen), Colors::Gray);
+        gfx.DrawRect(clipRect(RectI(border.left, border.right, boundary.bottom, border.bottom), screen), Colors::Gray);
+        gfx.DrawRect(clipRect(RectI(border.left, boundary.left, boundary.top, boundary.bottom), screen), Colors::Gray);
+        gfx.DrawRect(clipRect(RectI(boundary.right, border.right, boundary.top, boundary.bottom), screen), Colors::Gray);
+        // THE CACHED TILES ARE OPAQUE, SO THE BACKGROUND ONLY SHOWS WHERE TILES CUT BY THE SCREEN EDGE ARE LEFT OUT
+        const RectI visibleTiles(gridToPixelPosition(Vei2(xStart, yStart)), gridToPixelPosition(Vei2(xEnd, yEnd)));
+        const RectI visibleField = clipRect(boundary, screen);
+        if (visibleTiles.left != visibleField.left || visibleTiles.right != visibleField.right
+            || visibleTiles.top != visibleField.top || visibleTiles.bottom != visibleField.bottom)
         {
-            if (hasMine)
-            {
-                SpriteCodex::DrawTileBombRed(pixelPos, gfx);
-            }
-            else {
-                SpriteCodex::DrawTileNumber(pixelPos, nAdjacentMines, gfx);
-            }
+            gfx.DrawRect(visibleField, BACKGROUND_COLOR);
         }
-        break;
-        case MineField::Tile::State::Flagged:
-            if (hasMine)
-            {
-                SpriteCodex::DrawTileBomb(pixelPos, gfx);
-                SpriteCodex::DrawTileFlag(pixelPos, gfx);
-            }
-            else {
-                SpriteCodex::DrawTileBomb(pixelPos, gfx);
-                SpriteCodex::DrawTileCross(pixelPos, gfx);
-            }
-            break;
-        case MineField::Tile::State::Hidden:
-            if (hasMine)
+        if (xStart < xEnd)
+        {
+            rowTiles.resize(xEnd - xStart);
+            for (int y = yStart; y < yEnd; ++y)
             {
-                SpriteCodex::DrawTileBomb(pixelPos, gfx);
-            }
-            else {
-                SpriteCodex::DrawTileButton(pixelPos, gfx);
+                for (int x = xStart; x < xEnd; ++x)
+                {
+                    rowTiles[x - xStart] = getTileLook(Vei2(x, y));
+                }
+                const Vei2 pixelPos = gridToPixelPosition(Vei2(xStart, y));
+                gfx.DrawTileRow(pixelPos.x, pixelPos.y, tileSize, rowTiles.data(), xEnd - xStart);
             }
-            break;
         }
     }
-    else {
-        switch (state)
+    else if (hasChangedTiles)
+    {
+        for (int y = yStart; y < yEnd; ++y)
         {
-        case MineField::Tile::State::Revealed:
+            for (int k = xStart >> 6; k <= (xEnd - 1) >> 6; ++k)
             {
-                if (hasMine)
+                for (uint64_t bits = changedTiles.row(y)[k]; bits != 0u; bits &= bits - 1u)
                 {
-                    SpriteCodex::DrawTileBomb(pixelPos, gfx);
-                }
-                else {
-                    SpriteCodex::DrawTileNumber(pixelPos, nAdjacentMines, gfx);
+                    const Vei2 gridPos(k * 64 + countTrailingZeros(bits), y);
+                    if (gridPos.x >= xStart && gridPos.x < xEnd)
+                    {
+                        // THE CACHED TILES ARE OPAQUE, SO NOTHING OF THE OLD ONE SHOWS THROUGH
+                        const Color* const tile = getTileLook(gridPos);
+                        const Vei2 pixelPos = gridToPixelPosition(gridPos);
+                        gfx.DrawTileRow(pixelPos.x, pixelPos.y, tileSize, &tile, 1);
+                    }
                 }
             }
-            break;
-        case MineField::Tile::State::Flagged:
-            SpriteCodex::DrawTileButton(pixelPos, gfx);
-            SpriteCodex::DrawTileFlag(pixelPos, gfx);
-            break;
-        case MineField::Tile::State::Hidden:
-            SpriteCodex::DrawTileButton(pixelPos, gfx);
-            break;
         }
     }
+    if (hasChangedTiles) changedTiles.clear();
+    hasChangedTiles = false;
+    isFullRedrawNeeded = false;
 }
 
-void MineField::Tile::spawnMine()
+bool MineField::hasChanges() const
 {
-    assert(!hasMine);
-    hasMine = true;
+    return isFullRedrawNeeded || hasChangedTiles;
 }
 
-bool MineField::Tile::reveal()
+void MineField::requestFullRedraw()
 {
-    if (state == State::Hidden)
-    {
-        state = State::Revealed;
-        return true;
-    }
-    return false;
+    isFullRedrawNeeded = true;
 }
 
-void MineField::Tile::flag()
+void MineField::markChangedTiles()
 {
-    if (state == State::Hidden)
+    if (moveDelta.hasTriggeredMine)
     {
-        state = State::Flagged;
+        isFullRedrawNeeded = true;
+        return;
     }
-    else if (state == State::Flagged)
+    for (const Board::Delta::WordChange& change : moveDelta.changes)
     {
-        state = State::Hidden;
-    }
-}
-
-void MineField::Tile::setNumberOfAdjacentMines(int count)
-{
-    assert(nAdjacentMines == -1);
-    nAdjacentMines = count;
-}
-
-void MineField::draw(Graphics& gfx)
-{
-    int nTiles = TILES_PER_HEIGHT * TILES_PER_WIDTH;
-    gfx.DrawRect(boundary.GetExpanded(BORDER_WIDTH), Colors::Gray);
-    gfx.DrawRect(boundary, Colors::White);
-    for (int i = 0; i < nTiles; ++i)
-    {
-        minefield[i].draw(gfx, isMineTriggered);
+        changedTiles.row(change.y)[change.k] |= change.revealedBits | change.flaggedBits;
+        hasChangedTiles = true;
     }
 }
 
 bool MineField::mouseIsWithinField(const Mouse& mouse)
 {
-    int tileSize = SpriteCodex::tileSize;
     return boundary.Contains(mouse.GetPos());
 }
 
 bool MineField::mineTriggered()
 {
-    return isMineTriggered;
+    return board.mineTriggered();
 }
 
 bool MineField::allTilesRevealed()
 {
-    int nSafeTiles = (TILES_PER_HEIGHT * TILES_PER_WIDTH) - nMines;
-    return (nSafeTiles == nRevealedSafeTiles);
+    return board.allTilesRevealed();
 }
 
-void MineField::revealTile(const Vei2& pixelPos)
+uint64_t MineField::getSeed() const
 {
-    const Vei2 gridPos{ pixelToGridPosition(pixelPos) };
-    Tile& tile{ tileAt(gridPos) };
-    if (tile.reveal())
-    {
-        if (tileAt(gridPos).hasMine)
-        {
-            isMineTriggered = true;
-            return;
-        }
-        ++nRevealedSafeTiles;
-        revealAdjacentSafeTiles(tile, 2);
-    }
+    return board.getSeed();
 }
 
-void MineField::flagTile(const Vei2& pixelPos)
-{
-    const Vei2 gridPos{ pixelToGridPosition(pixelPos) };
-    minefield[gridPos.y * TILES_PER_WIDTH + gridPos.x].flag();
-}
-
-Vei2 MineField::pixelToGridPosition(const Vei2& pixelPos) const
+const MoveLog& MineField::getMoveLog() const
 {
-	int tileSize = SpriteCodex::tileSize;
-	assert(boundary.Contains(pixelPos));
-    // ACCOUNT FOR MARGIN OFFSET
-    Vei2 modifiedPixelPos{ pixelPos - Vei2(MARGIN_LEFT, MARGIN_TOP) };
-	return modifiedPixelPos / tileSize;
+    return moveLog;
 }
 
-int MineField::getNumberOfAdjacentMines(const Tile& tile)
+void MineField::revealTile(const Vei2& pixelPos)
 {
-    int xStart = std::max(0, tile.gridPos.x - 1);
-    int xEnd = std::min(TILES_PER_WIDTH - 1, tile.gridPos.x + 1);
-    int yStart = std::max(0, tile.gridPos.y - 1);
-    int yEnd = std::min(TILES_PER_HEIGHT - 1, tile.gridPos.y + 1);
-    int count = 0;
-    for (Vei2 gridPos = {xStart, yStart}; gridPos.y <= yEnd; ++gridPos.y)
+    const Vei2 gridPos = pixelToGridPosition(pixelPos);
+    if (generation == Generation::NoGuess && !board.minesPlaced() && !board.isFlagged(gridPos))
     {
-        for (gridPos.x = xStart; gridPos.x <= xEnd; ++gridPos.x)
+        // KEEP THE CLASSIC BOARD IF THE SEARCH GIVES UP, WHICH ONLY HAPPENS ON VERY DENSE FIELDS
+        NoGuessGenerator generator(board.getWidth(), board.getHeight(), board.getNumberOfMines(), board.getSeed());
+        if (generator.generate(gridPos, NO_GUESS_MAX_CANDIDATES))
         {
-            if (tileAt(gridPos).hasMine)
+            Board generated(board.getWidth(), board.getHeight(), board.getNumberOfMines(), generator.getBoardSeed());
+            for (Vei2 flagPos = { 0, 0 }; flagPos.y < board.getHeight(); ++flagPos.y)
             {
-                ++count;
+                for (flagPos.x = 0; flagPos.x < board.getWidth(); ++flagPos.x)
+                {
+                    if (board.isFlagged(flagPos)) generated.flagTile(flagPos);
+                }
             }
+            board = std::move(generated);
+            moveLog.setSeed(board.getSeed());
         }
     }
-    return count;
+    moveLog.recordReveal(gridPos);
+    board.revealTile(gridPos, &moveDelta);
+    markChangedTiles();
 }
 
-Vei2 MineField::Tile::gridToPixelPosition(const Vei2& gridPos) const
+void MineField::flagTile(const Vei2& pixelPos)
 {
-    return gridPos * SpriteCodex::tileSize;
+    const Vei2 gridPos = pixelToGridPosition(pixelPos);
+    moveLog.recordFlag(gridPos);
+    board.flagTile(gridPos, &moveDelta);
+    markChangedTiles();
 }
 
-void MineField::revealAdjacentSafeTiles(const Tile& tile, int nTimes)
+Vei2 MineField::gridToPixelPosition(const Vei2& gridPos) const
 {
-    if (nTimes == 0) return;
-
-    int xStart = std::max(0, tile.gridPos.x - 1);
-    int xEnd = std::min(TILES_PER_WIDTH - 1, tile.gridPos.x + 1);
-    int yStart = std::max(0, tile.gridPos.y - 1);
-    int yEnd = std::min(TILES_PER_HEIGHT - 1, tile.gridPos.y + 1);
-    for (Vei2 gridPos = { xStart, yStart }; gridPos.y <= yEnd; ++gridPos.y)
-    {
-        for (gridPos.x = xStart; gridPos.x <= xEnd; ++gridPos.x)
-        {
-            Tile& tile = tileAt(gridPos);
-            if (!tile.hasMine)
-            {
-                if (tile.reveal())
-                {
-                    ++nRevealedSafeTiles;
-                    revealAdjacentSafeTiles(tile, nTimes - 1);
-                }
-            }
-        }
-    }
+    // ADD THE MARGIN OFFSET TO ALL PIXELS TO BE DRAWN
+    return gridPos * SpriteCodex::tileSize + Vei2(marginLeft, marginTop);
 }
 
-MineField::Tile& MineField::tileAt(const Vei2& gridPos)
+Vei2 MineField::pixelToGridPosition(const Vei2& pixelPos) const
 {
-    return minefield[gridPos.y * TILES_PER_WIDTH + gridPos.x];
+	int tileSize = SpriteCodex::tileSize;
+	assert(boundary.Contains(pixelPos));
+    // ACCOUNT FOR MARGIN OFFSET
+    Vei2 modifiedPixelPos{ pixelPos - Vei2(marginLeft, marginTop) };
+	return modifiedPixelPos / tileSize;
 }
@@ -4,57 +4,61 @@
 #include "SpriteCodex.h"
 #include "Mouse.h"
 #include "RectI.h"
+#include "Board.h"
+#include "MoveLog.h"
+#include "TileCache.h"
+#include <vector>
 
+// RENDERS A BOARD CENTERED ON SCREEN AND TRANSLATES MOUSE INPUT INTO GRID COORDINATES
 class MineField
 {
 public:
-	MineField(int _nMines);
+	enum class Generation
+	{
+		// MINES ARE PLACED FROM THE SEED ON THE FIRST REVEAL
+		Classic,
+		// THE FIRST REVEAL SEARCHES A FEW HUNDRED CANDIDATES FROM THE SEED FOR A BOARD THAT CAN BE CLEARED
+		// WITHOUT GUESSING, KEEPING THE CLASSIC BOARD IF NONE IS
+		NoGuess
+	};
+public:
+	MineField(int width, int height, int nMines, Generation _generation = Generation::Classic);
+	MineField(int width, int height, int nMines, uint64_t seed, Generation _generation = Generation::Classic);
+	// DRAWS ONLY THE TILES WHOSE LOOK CHANGED SINCE THE LAST CALL, OVER THE PREVIOUS FRAME (EVERYTHING THE FIRST TIME
+	// AND WHEN A MINE GOES OFF, WHICH UNCOVERS ALL OF THEM)
 	void draw(Graphics& gfx);
+	bool hasChanges() const;
+	void requestFullRedraw();
 	void revealTile(const Vei2& pixelPos);
 	void flagTile(const Vei2& pixelPos);
 	bool mouseIsWithinField(const Mouse& mouse);
 	bool mineTriggered();
 	bool allTilesRevealed();
+	uint64_t getSeed() const;
+	// EVERY REVEAL AND FLAG SO FAR, REPLAYABLE ON A FRESH BOARD WITH Replay
+	const MoveLog& getMoveLog() const;
 private:
-	class Tile
-	{
-	public:
-		enum class State
-		{
-			Revealed, Flagged, Hidden
-		};
-	public:
-		Tile() = default;
-		Tile(const Vei2& pos);
-		void draw(Graphics& gfx, bool mineTriggered);
-		void spawnMine();
-		bool reveal();
-		void flag();
-		void setNumberOfAdjacentMines(int count);
-	private:
-		Vei2 gridToPixelPosition(const Vei2& gridPos) const;
-	public:
-		Vei2 gridPos;
-		State state;
-		bool hasMine;
-		int nAdjacentMines = -1;
-	};
-private:
-	int getNumberOfAdjacentMines(const Tile& tile);
-	void revealAdjacentSafeTiles(const Tile& tile, int nTimes = 1);
-	Tile& tileAt(const Vei2& gridPos);
+	const Color* getTileLook(const Vei2& gridPos) const;
+	void markChangedTiles();
+	Vei2 gridToPixelPosition(const Vei2& gridPos) const;
 	Vei2 pixelToGridPosition(const Vei2& pixelPos) const;
 private:
-	static constexpr int TILES_PER_WIDTH = 10;
-	static constexpr int TILES_PER_HEIGHT = 10;
-	static constexpr int MARGIN_LEFT = (Graphics::ScreenWidth/2) - ((TILES_PER_WIDTH * SpriteCodex::tileSize)/2);
-	static constexpr int MARGIN_TOP = (Graphics::ScreenHeight/2) - ((TILES_PER_HEIGHT * SpriteCodex::tileSize)/2);
 	static constexpr int BORDER_WIDTH = 10;
 private:
-	int nRevealedSafeTiles;
+	Generation generation;
+	Board board;
+	MoveLog moveLog;
+	// WHAT THE LAST MOVE CHANGED
+	Board::Delta moveDelta;
+	// TILES TO DRAW AGAIN, UNLESS THE WHOLE FIELD IS
+	BitPlane changedTiles;
+	bool hasChangedTiles = false;
+	bool isFullRedrawNeeded = true;
+	TileCache tileCache;
+	// THE TILES OF ONE ROW OF THE FIELD, DRAWN TOGETHER
+	std::vector<const Color*> rowTiles;
+	// TOP LEFT PIXEL OF THE FIELD, CENTERED ON SCREEN (NEGATIVE WHEN THE FIELD IS LARGER THAN THE SCREEN)
+	int marginLeft;
+	int marginTop;
 	RectI boundary;
-	int nMines;
-	bool isMineTriggered;
-	Tile minefield[TILES_PER_WIDTH * TILES_PER_HEIGHT];
 };
-
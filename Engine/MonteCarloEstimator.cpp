@@ -0,0 +1,437 @@
+#include "MonteCarloEstimator.h"
+#include "LogBinomial.h"
+#include <assert.h>
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace
+{
+    double uniformUnit(SplitMix64& rng)
+    {
+        return double(rng.next() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    // RUNS work ON EVERY CHAIN, EACH ON ITS OWN THREAD
+    template <typename ChainType, typename Work>
+    void forEachChainInParallel(std::vector<ChainType>& chains, Work work)
+    {
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < chains.size(); ++i)
+        {
+            workers.emplace_back([&chains, &work, i]() { work(chains[i], i); });
+        }
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+    }
+}
+
+MonteCarloEstimator::MonteCarloEstimator(const Board& _board, const Solver& _solver, uint64_t _seed, int _nThreads)
+    :board(_board), solver(_solver), seed(_seed),
+    nThreads(_nThreads > 0 ? _nThreads : std::max(1, int(std::thread::hardware_concurrency()))),
+    width(_board.getWidth())
+{
+}
+
+bool MonteCarloEstimator::prepare()
+{
+    const int height = board.getHeight();
+    frontierTiles.clear();
+    frontierSlot.assign(size_t(width) * height, -1);
+    constraintsOfSlot.clear();
+    slotsOfConstraint.clear();
+    required.clear();
+    chains.clear();
+
+    int nUnknown = 0;
+    int nKnownMines = 0;
+    for (Vei2 center = { 0, 0 }; center.y < height; ++center.y)
+    {
+        for (center.x = 0; center.x < width; ++center.x)
+        {
+            const Solver::Knowledge knowledge = solver.getKnowledge(center);
+            nUnknown += knowledge == Solver::Knowledge::Unknown;
+            nKnownMines += knowledge == Solver::Knowledge::Mine;
+            if (knowledge != Solver::Knowledge::Revealed) continue;
+
+            std::vector<int> slots;
+            int nMines = board.getNumberOfAdjacentMines(center);
+            for (int dy = -1; dy <= 1; ++dy)
+            {
+                for (int dx = -1; dx <= 1; ++dx)
+                {
+                    const Vei2 gridPos = center + Vei2(dx, dy);
+                    if (!board.isWithinBoard(gridPos)) continue;
+                    const Solver::Knowledge neighbor = solver.getKnowledge(gridPos);
+                    if (neighbor == Solver::Knowledge::Mine)
+                    {
+                        --nMines;
+                    }
+                    else if (neighbor == Solver::Knowledge::Unknown)
+                    {
+                        int& slot = frontierSlot[size_t(gridPos.y) * width + gridPos.x];
+                        if (slot < 0)
+                        {
+                            slot = int(frontierTiles.size());
+                            frontierTiles.push_back(gridPos.y * width + gridPos.x);
+                            constraintsOfSlot.emplace_back();
+                        }
+                        slots.push_back(slot);
+                        constraintsOfSlot[slot].push_back(int(required.size()));
+                    }
+                }
+            }
+            if (!slots.empty())
+            {
+                slotsOfConstraint.push_back(std::move(slots));
+                required.push_back(nMines);
+            }
+        }
+    }
+    const int nFrontier = int(frontierTiles.size());
+    nInterior = nUnknown - nFrontier;
+    nRemainingMines = board.getNumberOfMines() - nKnownMines;
+
+    logWeight.assign(nFrontier + 1, -INFINITY);
+    for (int f = 0; f <= nFrontier; ++f)
+    {
+        const int nInteriorMines = nRemainingMines - f;
+        if (nInteriorMines >= 0 && nInteriorMines <= nInterior)
+        {
+            logWeight[f] = logBinomial(nInterior, nInteriorMines);
+        }
+    }
+
+    // A WINDOW IS THE TILE PLUS THE TILES REACHED FROM IT BREADTH-FIRST THROUGH SHARED NUMBERS, SO A CHAIN OF
+    // TILES THAT CAN ONLY CHANGE TOGETHER IS REDRAWN TOGETHER. IT ONLY DEPENDS ON THE TILE, NOT ON THE CHAIN'S
+    // STATE, AS BLOCK GIBBS SAMPLING REQUIRES
+    windows.assign(nFrontier, std::vector<int>());
+    std::vector<int> visitedBy(nFrontier, -1);
+    for (int slot = 0; slot < nFrontier; ++slot)
+    {
+        std::vector<int>& window = windows[slot];
+        window.push_back(slot);
+        visitedBy[slot] = slot;
+        for (size_t head = 0; head < window.size() && window.size() < WINDOW_TILES; ++head)
+        {
+            for (int c : constraintsOfSlot[window[head]])
+            {
+                for (int other : slotsOfConstraint[c])
+                {
+                    if (visitedBy[other] != slot && window.size() < WINDOW_TILES)
+                    {
+                        visitedBy[other] = slot;
+                        window.push_back(other);
+                    }
+                }
+            }
+        }
+    }
+
+    // EVERY CHAIN GETS ITS OWN STREAM: SUCCESSIVE OUTPUTS OF A GENERATOR SEEDED WITH THE ESTIMATOR'S SEED. THE
+    // STARTING LAYOUTS ARE DRAWN FROM THOSE STREAMS TOO, SO CHAINS THAT FAIL TO MIX SHOW UP AS A WIDE INTERVAL
+    SplitMix64 streams(seed);
+    for (int i = 0; i < nThreads; ++i)
+    {
+        chains.emplace_back(streams.next());
+        Chain& chain = chains.back();
+        chain.mines.assign(nFrontier, 0);
+        chain.constraintMines.assign(required.size(), 0);
+        chain.hits.assign(nFrontier, 0);
+        chain.windowBase.assign(required.size(), 0);
+        chain.windowUnassigned.assign(required.size(), 0);
+    }
+    // THE SEARCH FOR A STARTING LAYOUT CAN TAKE MILLIONS OF NODES, SO EACH CHAIN SEARCHES AND BURNS IN ON ITS
+    // OWN THREAD, USING ONLY ITS OWN STREAM
+    std::vector<unsigned char> isStarted(chains.size(), 0);
+    forEachChainInParallel(chains, [this, &isStarted](Chain& chain, size_t i)
+    {
+        if (!findStartingLayout(chain)) return;
+        for (int sweepIndex = 0; sweepIndex < BURN_IN_SWEEPS; ++sweepIndex)
+        {
+            sweep(chain);
+        }
+        isStarted[i] = 1;
+    });
+    if (std::find(isStarted.begin(), isStarted.end(), 0) != isStarted.end())
+    {
+        chains.clear();
+        return false;
+    }
+    return true;
+}
+
+bool MonteCarloEstimator::findStartingLayout(Chain& chain) const
+{
+    // DEPTH-FIRST SEARCH IN ROW-MAJOR TILE ORDER, WHICH CLOSES EACH NUMBER WITHIN TWO ROWS OF ITS FIRST TILE.
+    // EACH TILE TRIES ITS TWO VALUES IN A RANDOM ORDER. THE FIRST LAYOUT THAT ALSO LEAVES A FEASIBLE NUMBER OF
+    // MINES FOR THE INTERIOR IS TAKEN
+    const int nFrontier = int(frontierTiles.size());
+    std::vector<int> order(nFrontier);
+    for (int i = 0; i < nFrontier; ++i)
+    {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [this](int a, int b) { return frontierTiles[a] < frontierTiles[b]; });
+
+    std::vector<int> nUnassigned(required.size());
+    for (size_t c = 0; c < required.size(); ++c)
+    {
+        nUnassigned[c] = int(slotsOfConstraint[c].size());
+    }
+    std::vector<unsigned char> nTried(nFrontier, 0);
+    std::vector<unsigned char> firstValue(nFrontier);
+    for (int i = 0; i < nFrontier; ++i)
+    {
+        firstValue[i] = (unsigned char)(chain.rng.next() >> 63);
+    }
+    std::vector<unsigned char> applied(nFrontier, 0);
+    long long nNodes = 0;
+    const long long nodeBudget = 64ll * 1024 * 1024;
+    int pos = 0;
+    while (pos >= 0)
+    {
+        if (pos == nFrontier)
+        {
+            if (logWeight[chain.nFrontierMines] > -INFINITY) return true;
+            --pos;
+            continue;
+        }
+        const int slot = order[pos];
+        if (applied[pos])
+        {
+            for (int c : constraintsOfSlot[slot])
+            {
+                ++nUnassigned[c];
+                chain.constraintMines[c] -= chain.mines[slot];
+            }
+            chain.nFrontierMines -= chain.mines[slot];
+            chain.mines[slot] = 0;
+            applied[pos] = 0;
+        }
+        if (nTried[pos] == 2 || ++nNodes > nodeBudget)
+        {
+            if (nNodes > nodeBudget) return false;
+            nTried[pos] = 0;
+            --pos;
+            continue;
+        }
+        const int value = firstValue[pos] ^ nTried[pos]++;
+        bool isFeasible = chain.nFrontierMines + value <= nRemainingMines;
+        for (int c : constraintsOfSlot[slot])
+        {
+            const int nMinesAfter = chain.constraintMines[c] + value;
+            isFeasible &= nMinesAfter <= required[c] && nMinesAfter + nUnassigned[c] - 1 >= required[c];
+        }
+        if (isFeasible)
+        {
+            for (int c : constraintsOfSlot[slot])
+            {
+                --nUnassigned[c];
+                chain.constraintMines[c] += value;
+            }
+            chain.nFrontierMines += value;
+            chain.mines[slot] = (unsigned char)value;
+            applied[pos] = 1;
+            ++pos;
+        }
+    }
+    return false;
+}
+
+void MonteCarloEstimator::run(int nSweeps)
+{
+    forEachChainInParallel(chains, [this, nSweeps](Chain& chain, size_t)
+    {
+        for (int i = 0; i < nSweeps; ++i)
+        {
+            sweep(chain);
+            for (size_t slot = 0; slot < chain.mines.size(); ++slot)
+            {
+                chain.hits[slot] += chain.mines[slot];
+            }
+            chain.interiorMines += nRemainingMines - chain.nFrontierMines;
+            ++chain.nSamples;
+        }
+    });
+}
+
+void MonteCarloEstimator::sweep(Chain& chain) const
+{
+    const int nFrontier = int(frontierTiles.size());
+    for (int i = 0; i < nFrontier; ++i)
+    {
+        redrawWindow(chain, int(chain.rng.nextBelow(uint32_t(nFrontier))));
+    }
+}
+
+void MonteCarloEstimator::redrawWindow(Chain& chain, int slot) const
+{
+    // TAKE THE WINDOW'S MINES OUT OF THE COUNTS, ENUMERATE EVERY LAYOUT OF THE WINDOW THAT SATISFIES THE NUMBERS
+    // AROUND IT, AND DRAW ONE IN PROPORTION TO THE NUMBER OF FULL-BOARD LAYOUTS IT EXTENDS TO
+    const std::vector<int>& window = windows[slot];
+    int nWindowMines = 0;
+    for (int tile : window)
+    {
+        nWindowMines += chain.mines[tile];
+        for (int c : constraintsOfSlot[tile])
+        {
+            chain.windowBase[c] = chain.constraintMines[c];
+            chain.windowUnassigned[c] = 0;
+        }
+    }
+    for (int tile : window)
+    {
+        for (int c : constraintsOfSlot[tile])
+        {
+            chain.windowBase[c] -= chain.mines[tile];
+            ++chain.windowUnassigned[c];
+        }
+    }
+    chain.layouts.clear();
+    enumerateWindow(chain, window, 0, 0u);
+
+    const int nOtherMines = chain.nFrontierMines - nWindowMines;
+    double maxLogWeight = -INFINITY;
+    for (unsigned layout : chain.layouts)
+    {
+        maxLogWeight = std::max(maxLogWeight, logWeight[nOtherMines + popCount(layout)]);
+    }
+    chain.layoutWeights.clear();
+    double totalWeight = 0.0;
+    for (unsigned layout : chain.layouts)
+    {
+        totalWeight += std::exp(logWeight[nOtherMines + popCount(layout)] - maxLogWeight);
+        chain.layoutWeights.push_back(totalWeight);
+    }
+    const double pick = uniformUnit(chain.rng) * totalWeight;
+    const size_t chosen = std::min(chain.layouts.size() - 1,
+        size_t(std::upper_bound(chain.layoutWeights.begin(), chain.layoutWeights.end(), pick) - chain.layoutWeights.begin()));
+    const unsigned layout = chain.layouts[chosen];
+
+    for (size_t i = 0; i < window.size(); ++i)
+    {
+        const int tile = window[i];
+        const int value = (layout >> i) & 1u;
+        if (value != chain.mines[tile])
+        {
+            for (int c : constraintsOfSlot[tile])
+            {
+                chain.constraintMines[c] += value - chain.mines[tile];
+            }
+            chain.mines[tile] = (unsigned char)value;
+        }
+    }
+    chain.nFrontierMines = nOtherMines + popCount(layout);
+}
+
+void MonteCarloEstimator::enumerateWindow(Chain& chain, const std::vector<int>& window, int depth, unsigned layout) const
+{
+    // AT MOST WINDOW_TILES DEEP, AND THE NUMBERS PRUNE MOST BRANCHES LONG BEFORE THAT
+    if (depth == int(window.size()))
+    {
+        chain.layouts.push_back(layout);
+        return;
+    }
+    const int tile = window[depth];
+    for (int value = 0; value <= 1; ++value)
+    {
+        bool isFeasible = true;
+        for (int c : constraintsOfSlot[tile])
+        {
+            const int nMinesAfter = chain.windowBase[c] + value;
+            isFeasible &= nMinesAfter <= required[c] && nMinesAfter + chain.windowUnassigned[c] - 1 >= required[c];
+        }
+        if (!isFeasible) continue;
+        for (int c : constraintsOfSlot[tile])
+        {
+            chain.windowBase[c] += value;
+            --chain.windowUnassigned[c];
+        }
+        enumerateWindow(chain, window, depth + 1, layout | (unsigned(value) << depth));
+        for (int c : constraintsOfSlot[tile])
+        {
+            chain.windowBase[c] -= value;
+            ++chain.windowUnassigned[c];
+        }
+    }
+}
+
+double MonteCarloEstimator::estimate(const Chain& chain, int slot) const
+{
+    if (chain.nSamples == 0) return 0.0;
+    if (slot >= 0)
+    {
+        return double(chain.hits[slot]) / chain.nSamples;
+    }
+    return nInterior > 0 ? double(chain.interiorMines) / chain.nSamples / nInterior : 0.0;
+}
+
+double MonteCarloEstimator::getMineProbability(const Vei2& gridPos) const
+{
+    switch (solver.getKnowledge(gridPos))
+    {
+    case Solver::Knowledge::Mine:
+        return 1.0;
+    case Solver::Knowledge::Unknown:
+    {
+        const int slot = frontierSlot[size_t(gridPos.y) * width + gridPos.x];
+        long long nSamples = 0;
+        double sum = 0.0;
+        for (const Chain& chain : chains)
+        {
+            sum += estimate(chain, slot) * chain.nSamples;
+            nSamples += chain.nSamples;
+        }
+        return nSamples > 0 ? sum / nSamples : 0.0;
+    }
+    default:
+        return 0.0;
+    }
+}
+
+double MonteCarloEstimator::getConfidenceHalfWidth() const
+{
+    // THE CHAINS ARE INDEPENDENT, SO THE SPREAD OF THEIR ESTIMATES GIVES A STANDARD ERROR THAT ALREADY ACCOUNTS
+    // FOR THE CORRELATION BETWEEN SUCCESSIVE SAMPLES OF ONE CHAIN. ONE CHAIN FALLS BACK TO THE BINOMIAL ERROR
+    const int nChains = int(chains.size());
+    if (nChains == 0 || getNumberOfSamples() == 0) return 1.0;
+    double widest = 0.0;
+    for (int slot = -1; slot < int(frontierTiles.size()); ++slot)
+    {
+        double mean = 0.0;
+        for (const Chain& chain : chains)
+        {
+            mean += estimate(chain, slot);
+        }
+        mean /= nChains;
+        double variance;
+        if (nChains > 1)
+        {
+            double sumOfSquares = 0.0;
+            for (const Chain& chain : chains)
+            {
+                const double deviation = estimate(chain, slot) - mean;
+                sumOfSquares += deviation * deviation;
+            }
+            variance = sumOfSquares / (nChains - 1) / nChains;
+        }
+        else {
+            variance = mean * (1.0 - mean) / chains[0].nSamples;
+        }
+        widest = std::max(widest, 1.96 * std::sqrt(variance));
+    }
+    return widest;
+}
+
+long long MonteCarloEstimator::getNumberOfSamples() const
+{
+    long long nSamples = 0;
+    for (const Chain& chain : chains)
+    {
+        nSamples += chain.nSamples;
+    }
+    return nSamples;
+}
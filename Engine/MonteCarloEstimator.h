@@ -0,0 +1,75 @@
+#pragma once
+#include "Board.h"
+#include "Solver.h"
+#include "SplitMix64.h"
+#include "Vei2.h"
+#include <vector>
+
+// ESTIMATES MINE PROBABILITIES BY SAMPLING MINE LAYOUTS CONSISTENT WITH THE VISIBLE STATE, FOR FRONTIERS TOO LARGE
+// TO ENUMERATE EXACTLY. EVERY THREAD RUNS ITS OWN MARKOV CHAIN WITH ITS OWN RANDOM STREAM AND HIT COUNTS, WHICH
+// ARE ONLY READ AFTER THE THREADS ARE JOINED. EACH STEP REDRAWS A SMALL WINDOW OF FRONTIER TILES FROM ITS EXACT
+// CONDITIONAL DISTRIBUTION (BLOCK GIBBS SAMPLING); THE TILES AWAY FROM THE FRONTIER ARE ONLY TRACKED AS A COUNT
+class MonteCarloEstimator
+{
+public:
+	// _nThreads == 0 USES EVERY HARDWARE THREAD
+	MonteCarloEstimator(const Board& _board, const Solver& _solver, uint64_t _seed, int _nThreads = 0);
+	// BUILDS THE CONSTRAINTS FROM THE CURRENT VIEW, THEN FINDS A STARTING LAYOUT AND BURNS IN EVERY CHAIN ON ITS
+	// OWN THREAD; FALSE IF SOME CHAIN FINDS NO LAYOUT
+	bool prepare();
+	// ADDS nSweeps SAMPLES PER THREAD, WHERE A SWEEP REDRAWS AS MANY WINDOWS AS THERE ARE FRONTIER TILES.
+	// MAY BE CALLED REPEATEDLY; THE CHAINS CONTINUE WHERE THEY STOPPED AND THE ESTIMATES KEEP IMPROVING
+	void run(int nSweeps);
+	double getMineProbability(const Vei2& gridPos) const;
+	// LARGEST HALF-WIDTH OF THE 95% CONFIDENCE INTERVALS OF THE ESTIMATES, FROM THE SPREAD BETWEEN THE CHAINS
+	double getConfidenceHalfWidth() const;
+	long long getNumberOfSamples() const;
+private:
+	struct alignas(64) Chain
+	{
+		Chain(uint64_t seed)
+			:rng(seed)
+		{
+		}
+		SplitMix64 rng;
+		std::vector<unsigned char> mines;
+		std::vector<int> constraintMines;
+		int nFrontierMines = 0;
+		std::vector<long long> hits;
+		long long interiorMines = 0;
+		long long nSamples = 0;
+		// SCRATCH OF THE WINDOW ENUMERATION
+		std::vector<int> windowBase;
+		std::vector<int> windowUnassigned;
+		std::vector<unsigned> layouts;
+		std::vector<double> layoutWeights;
+	};
+private:
+	bool findStartingLayout(Chain& chain) const;
+	void sweep(Chain& chain) const;
+	void redrawWindow(Chain& chain, int slot) const;
+	void enumerateWindow(Chain& chain, const std::vector<int>& window, int depth, unsigned layout) const;
+	double estimate(const Chain& chain, int slot) const;
+private:
+	static constexpr int WINDOW_TILES = 12;
+	static constexpr int BURN_IN_SWEEPS = 32;
+private:
+	const Board& board;
+	const Solver& solver;
+	uint64_t seed;
+	int nThreads;
+	int width;
+	// FRONTIER TILES AND THE NUMBERS THAT CONSTRAIN THEM
+	std::vector<int> frontierTiles;
+	std::vector<int> frontierSlot;
+	std::vector<std::vector<int>> constraintsOfSlot;
+	std::vector<std::vector<int>> slotsOfConstraint;
+	std::vector<int> required;
+	// THE FRONTIER TILES REDRAWN TOGETHER WITH EACH TILE: ITSELF AND THE TILES NEAREST TO IT THROUGH SHARED NUMBERS
+	std::vector<std::vector<int>> windows;
+	int nInterior = 0;
+	int nRemainingMines = 0;
+	// logWeight[f]: LOG OF THE NUMBER OF WAYS TO PLACE THE OTHER MINES AWAY FROM THE FRONTIER WHEN f ARE ON IT
+	std::vector<double> logWeight;
+	std::vector<Chain> chains;
+};
@@ -0,0 +1,120 @@
+#include "MoveLog.h"
+#include <assert.h>
+
+MoveLog::MoveLog(int _width, int _height, int _nMines, uint64_t _seed)
+    :width(_width), height(_height), nMines(_nMines), seed(_seed)
+{
+}
+
+MoveLog::MoveLog(int _width, int _height, int _nMines, uint64_t _seed, std::vector<unsigned char> _bytes)
+    :width(_width), height(_height), nMines(_nMines), seed(_seed), bytes(std::move(_bytes))
+{
+    // COUNT THE EVENTS AND FIND THE LAST TILE SO RECORDING CAN CONTINUE, RIGHT AFTER THE LAST VALID EVENT
+    Cursor cursor;
+    Event event;
+    while (next(cursor, event))
+    {
+    }
+    if (cursor.offset < bytes.size())
+    {
+        bytes.resize(cursor.offset);
+        hasOnlyValidEvents = false;
+    }
+    lastTile = cursor.tile;
+    nEvents = cursor.nEvents;
+}
+
+void MoveLog::recordReveal(const Vei2& gridPos)
+{
+    record(gridPos, false);
+}
+
+void MoveLog::recordFlag(const Vei2& gridPos)
+{
+    record(gridPos, true);
+}
+
+void MoveLog::record(const Vei2& gridPos, bool isFlag)
+{
+    assert(gridPos.x >= 0 && gridPos.x < width && gridPos.y >= 0 && gridPos.y < height);
+    const int tile = gridPos.y * width + gridPos.x;
+    const int64_t delta = int64_t(tile) - lastTile;
+    const uint64_t zigzag = (uint64_t(delta) << 1) ^ uint64_t(delta >> 63);
+    uint64_t value = (zigzag << 1) | uint64_t(isFlag);
+    while (value >= 0x80u)
+    {
+        bytes.push_back((unsigned char)(value | 0x80u));
+        value >>= 7;
+    }
+    bytes.push_back((unsigned char)value);
+    lastTile = tile;
+    ++nEvents;
+}
+
+bool MoveLog::next(Cursor& cursor, Event& event) const
+{
+    size_t offset = cursor.offset;
+    uint64_t value = 0;
+    int shift = 0;
+    unsigned char byte;
+    do
+    {
+        // A VARINT THAT RUNS OFF THE END OF THE LOG OR PAST 64 BITS
+        if (offset >= bytes.size() || shift >= 64) return false;
+        byte = bytes[offset++];
+        value |= uint64_t(byte & 0x7Fu) << shift;
+        shift += 7;
+    } while (byte & 0x80u);
+
+    const uint64_t zigzag = value >> 1;
+    const int64_t delta = int64_t(zigzag >> 1) ^ -int64_t(zigzag & 1u);
+    // COMPARED AS AN UNSIGNED DISTANCE SO A DELTA NEAR EITHER END OF THE int64_t RANGE CANNOT WRAP INTO THE BOARD
+    const uint64_t tile = uint64_t(int64_t(cursor.tile)) + uint64_t(delta);
+    if (tile >= uint64_t(width) * uint64_t(height)) return false;
+    cursor.offset = offset;
+    cursor.tile = int(tile);
+    ++cursor.nEvents;
+    event.gridPos = Vei2(cursor.tile % width, cursor.tile / width);
+    event.isFlag = (value & 1u) != 0;
+    return true;
+}
+
+void MoveLog::setSeed(uint64_t _seed)
+{
+    seed = _seed;
+}
+
+int MoveLog::getWidth() const
+{
+    return width;
+}
+
+int MoveLog::getHeight() const
+{
+    return height;
+}
+
+int MoveLog::getNumberOfMines() const
+{
+    return nMines;
+}
+
+uint64_t MoveLog::getSeed() const
+{
+    return seed;
+}
+
+long long MoveLog::getNumberOfEvents() const
+{
+    return nEvents;
+}
+
+const std::vector<unsigned char>& MoveLog::getBytes() const
+{
+    return bytes;
+}
+
+bool MoveLog::isValid() const
+{
+    return hasOnlyValidEvents;
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "Vei2.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// EVERY revealTile AND flagTile CALL OF A GAME, TOGETHER WITH WHAT IS NEEDED TO REBUILD ITS BOARD (SIZE, NUMBER
+// OF MINES AND SEED). AN EVENT IS ONE VARINT: THE ZIGZAG-ENCODED DISTANCE FROM THE PREVIOUS EVENT'S TILE (ROW BY
+// ROW), SHIFTED LEFT ONE BIT WITH THE LOW BIT SET FOR A FLAG. MOST MOVES ARE CLOSE TO THE LAST ONE, SO A TYPICAL
+// EVENT TAKES ONE OR TWO BYTES
+class MoveLog
+{
+public:
+	struct Event
+	{
+		Vei2 gridPos;
+		bool isFlag;
+	};
+	// POSITION IN THE LOG: THE NEXT BYTE TO DECODE AND THE TILE OF THE LAST EVENT DECODED
+	struct Cursor
+	{
+		size_t offset = 0;
+		int tile = 0;
+		long long nEvents = 0;
+	};
+public:
+	MoveLog(int _width, int _height, int _nMines, uint64_t _seed);
+	// A LOG READ BACK FROM ITS BYTES. THEY ARE DECODED UP TO THE FIRST EVENT THAT IS TRUNCATED OR FALLS OUTSIDE
+	// THE BOARD; THAT EVENT AND EVERYTHING AFTER IT IS DROPPED AND isValid() RETURNS FALSE
+	MoveLog(int _width, int _height, int _nMines, uint64_t _seed, std::vector<unsigned char> _bytes);
+	void recordReveal(const Vei2& gridPos);
+	void recordFlag(const Vei2& gridPos);
+	// FALSE AT THE END OF THE LOG, OR AT AN EVENT THAT IS TRUNCATED OR FALLS OUTSIDE THE BOARD, WHICH LEAVES THE
+	// CURSOR WHERE IT WAS
+	bool next(Cursor& cursor, Event& event) const;
+	// THE SEED CAN STILL CHANGE UNTIL THE MINES ARE PLACED, AS WHEN A NO-GUESS BOARD REPLACES THE FIRST ONE
+	void setSeed(uint64_t _seed);
+	int getWidth() const;
+	int getHeight() const;
+	int getNumberOfMines() const;
+	uint64_t getSeed() const;
+	long long getNumberOfEvents() const;
+	const std::vector<unsigned char>& getBytes() const;
+	// FALSE IF THE BYTES THE LOG WAS READ BACK FROM HELD A MALFORMED EVENT
+	bool isValid() const;
+private:
+	void record(const Vei2& gridPos, bool isFlag);
+private:
+	int width;
+	int height;
+	int nMines;
+	uint64_t seed;
+	std::vector<unsigned char> bytes;
+	int lastTile = 0;
+	long long nEvents = 0;
+	bool hasOnlyValidEvents = true;
+};
@@ -0,0 +1,125 @@
+#include "NoGuessGenerator.h"
+#include "Solver.h"
+#include "SplitMix64.h"
+#include <assert.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+NoGuessGenerator::NoGuessGenerator(int _width, int _height, int _nMines, uint64_t _seed, int _nThreads)
+    :width(_width), height(_height), nMines(_nMines), seed(_seed),
+    nThreads(_nThreads > 0 ? _nThreads : std::max(1, int(std::thread::hardware_concurrency())))
+{
+}
+
+bool NoGuessGenerator::generate(const Vei2& firstRevealedPos, long long maxCandidates)
+{
+    assert(firstRevealedPos.x >= 0 && firstRevealedPos.x < width);
+    assert(firstRevealedPos.y >= 0 && firstRevealedPos.y < height);
+
+    std::atomic<long long> nextCandidate(0);
+    std::atomic<long long> bestCandidate(maxCandidates);
+    std::atomic<long long> nTried(0);
+    // THE CANDIDATE EACH WORKER IS PLAYING, SO A SUCCESS CAN CANCEL THE ONES PAST IT
+    struct WorkerState
+    {
+        std::atomic<long long> candidate{ -1 };
+        std::atomic<bool> isCancelled{ false };
+    };
+    std::vector<WorkerState> states(nThreads);
+    auto worker = [&](int iWorker)
+    {
+        WorkerState& state = states[iWorker];
+        long long nTriedHere = 0;
+        for (;;)
+        {
+            // CANDIDATES ARE CLAIMED IN ORDER, SO EVERY CANDIDATE BELOW A SUCCESS HAS ALREADY BEEN CLAIMED AND
+            // WILL BE FINISHED; ONLY THE ONES ABOVE IT ARE ABANDONED. THE CLAIM IS PUBLISHED BEFORE bestCandidate
+            // IS READ, SO A SUCCESS EITHER STOPS IT HERE OR SEES IT AND CANCELS IT
+            const long long index = nextCandidate.fetch_add(1);
+            state.isCancelled = false;
+            state.candidate = index;
+            if (index >= bestCandidate.load()) break;
+            ++nTriedHere;
+            Board board(width, height, nMines, candidateSeed(seed, index));
+            if (isSolvableWithoutGuessing(board, firstRevealedPos, &state.isCancelled))
+            {
+                long long best = bestCandidate.load();
+                while (index < best && !bestCandidate.compare_exchange_weak(best, index))
+                {
+                }
+                for (WorkerState& other : states)
+                {
+                    if (other.candidate.load() > index) other.isCancelled = true;
+                }
+                break;
+            }
+        }
+        nTried += nTriedHere;
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int i = 1; i < nThreads; ++i)
+    {
+        workers.emplace_back(worker, i);
+    }
+    worker(0);
+    for (std::thread& thread : workers)
+    {
+        thread.join();
+    }
+    elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    nCandidatesTried = nTried.load();
+
+    if (bestCandidate.load() == maxCandidates) return false;
+    boardSeed = candidateSeed(seed, bestCandidate.load());
+    return true;
+}
+
+uint64_t NoGuessGenerator::getBoardSeed() const
+{
+    return boardSeed;
+}
+
+long long NoGuessGenerator::getNumberOfCandidatesTried() const
+{
+    return nCandidatesTried;
+}
+
+double NoGuessGenerator::getBoardsPerSecondPerCore() const
+{
+    return elapsedSeconds > 0.0 ? nCandidatesTried / elapsedSeconds / nThreads : 0.0;
+}
+
+int NoGuessGenerator::getNumberOfThreads() const
+{
+    return nThreads;
+}
+
+uint64_t NoGuessGenerator::candidateSeed(uint64_t seed, long long index)
+{
+    return SplitMix64::at(seed, uint64_t(index));
+}
+
+bool NoGuessGenerator::isSolvableWithoutGuessing(Board& board, const Vei2& firstRevealedPos,
+    const std::atomic<bool>* pIsCancelled)
+{
+    Solver solver(board);
+    board.revealTile(firstRevealedPos);
+    std::vector<Vei2> safeTiles;
+    while (!board.allTilesRevealed())
+    {
+        if (pIsCancelled && pIsCancelled->load()) return false;
+        solver.update();
+        if (solver.getSafeTiles().empty()) return false;
+        safeTiles = solver.getSafeTiles();
+        for (const Vei2& gridPos : safeTiles)
+        {
+            board.revealTile(gridPos);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "Board.h"
+#include "Vei2.h"
+#include <atomic>
+#include <cstdint>
+
+// SEARCHES FOR A BOARD THAT THE SOLVER CAN CLEAR FROM THE FIRST REVEAL WITHOUT EVER GUESSING. CANDIDATE i IS
+// THE BOARD SEEDED WITH THE i-TH OUTPUT OF A SPLITMIX64 STREAM FROM THE BASE SEED. WORKER THREADS CLAIM
+// CANDIDATES IN INCREASING ORDER, AND A SUCCESS STOPS EVERY WORKER FROM CLAIMING CANDIDATES PAST IT, SO THE
+// RESULT IS ALWAYS THE LOWEST SOLVABLE CANDIDATE, WHATEVER THE NUMBER OF THREADS. A WORKER STILL PLAYING A
+// CANDIDATE PAST A SUCCESS IS CANCELLED AND STOPS AT ITS NEXT SOLVER PASS
+class NoGuessGenerator
+{
+public:
+	// _nThreads == 0 USES EVERY HARDWARE THREAD
+	NoGuessGenerator(int _width, int _height, int _nMines, uint64_t _seed, int _nThreads = 0);
+	// FALSE WHEN NONE OF THE FIRST maxCandidates BOARDS IS SOLVABLE WITHOUT GUESSING
+	bool generate(const Vei2& firstRevealedPos, long long maxCandidates = 100000);
+	// SEED OF THE BOARD FOUND BY THE LAST SUCCESSFUL generate()
+	uint64_t getBoardSeed() const;
+	long long getNumberOfCandidatesTried() const;
+	double getBoardsPerSecondPerCore() const;
+	int getNumberOfThreads() const;
+	static uint64_t candidateSeed(uint64_t seed, long long index);
+	// PLAYS A FRESH BOARD WITH THE SOLVER, ONLY EVER REVEALING TILES IT HAS PROVEN SAFE. RETURNS FALSE AS SOON AS
+	// *pIsCancelled IS SET, CHECKED BEFORE EVERY SOLVER PASS
+	static bool isSolvableWithoutGuessing(Board& board, const Vei2& firstRevealedPos,
+		const std::atomic<bool>* pIsCancelled = nullptr);
+private:
+	int width;
+	int height;
+	int nMines;
+	uint64_t seed;
+	int nThreads;
+	uint64_t boardSeed = 0;
+	long long nCandidatesTried = 0;
+	double elapsedSeconds = 0.0;
+};
@@ -0,0 +1,494 @@
+#include "ProbabilityEngine.h"
+#include "LogBinomial.h"
+#include <assert.h>
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    std::vector<double> convolve(const std::vector<double>& a, const std::vector<double>& b)
+    {
+        std::vector<double> result(a.size() + b.size() - 1, 0.0);
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            if (a[i] == 0.0) continue;
+            for (size_t j = 0; j < b.size(); ++j)
+            {
+                result[i + j] += a[i] * b[j];
+            }
+        }
+        return result;
+    }
+}
+
+ProbabilityEngine::ProbabilityEngine(const Board& _board, const Solver& _solver, long long _nodeBudget)
+    :board(_board), solver(_solver), nodeBudget(_nodeBudget), width(_board.getWidth()), height(_board.getHeight())
+{
+}
+
+void ProbabilityEngine::compute()
+{
+    ++computeCount;
+    collectComponents();
+
+    int nUnknown = 0;
+    int nKnownMines = 0;
+    interiorTile = -1;
+    for (Vei2 gridPos = { 0, 0 }; gridPos.y < height; ++gridPos.y)
+    {
+        for (gridPos.x = 0; gridPos.x < width; ++gridPos.x)
+        {
+            const Solver::Knowledge knowledge = solver.getKnowledge(gridPos);
+            if (knowledge == Solver::Knowledge::Unknown)
+            {
+                ++nUnknown;
+            }
+            else if (knowledge == Solver::Knowledge::Mine)
+            {
+                ++nKnownMines;
+            }
+        }
+    }
+    int nFrontier = 0;
+    for (const Component& component : components)
+    {
+        nFrontier += int(component.tiles.size());
+    }
+    const int nRemainingMines = board.getNumberOfMines() - nKnownMines;
+    const int nInterior = nUnknown - nFrontier;
+    const double density = nUnknown > 0 ? double(nRemainingMines) / nUnknown : 0.0;
+
+    // ENUMERATE (OR REUSE) EVERY COMPONENT. THE TILES OF ONES OVER BUDGET ARE POOLED WITH THE INTERIOR: THEY STILL
+    // TAKE THEIR SHARE OF THE REMAINING MINES, BUT AS IF NO NUMBER CONSTRAINED THEM
+    exact = true;
+    frontierProbability.clear();
+    std::vector<const Component*> solvedComponents;
+    std::vector<const Solution*> solutions;
+    std::vector<int> pooledFrontierTiles;
+    for (const Component& component : components)
+    {
+        std::vector<int> key = makeKey(component);
+        auto it = solutionCache.find(key);
+        if (it == solutionCache.end())
+        {
+            it = solutionCache.emplace(std::move(key), enumerate(component)).first;
+        }
+        it->second.lastUsed = computeCount;
+        if (it->second.isExact)
+        {
+            solvedComponents.push_back(&component);
+            solutions.push_back(&it->second);
+        }
+        else {
+            exact = false;
+            pooledFrontierTiles.insert(pooledFrontierTiles.end(), component.tiles.begin(), component.tiles.end());
+        }
+    }
+    const int nPooled = nInterior + int(pooledFrontierTiles.size());
+
+    // WEIGHT OF EACH TOTAL NUMBER OF MINES K ON THE SOLVED COMPONENTS: THE WAYS TO PLACE THE REMAINING MINES IN
+    // THE POOL, C(nPooled, nRemainingMines - K), KEPT IN LOG SPACE AND RESCALED SO HUGE BOARDS DO NOT OVERFLOW
+    int maxFrontierMines = 0;
+    for (const Solution* solution : solutions)
+    {
+        maxFrontierMines += int(solution->solutions.size()) - 1;
+    }
+    std::vector<double> interiorWeight(maxFrontierMines + 1, 0.0);
+    double maxLogWeight = -INFINITY;
+    for (int k = 0; k <= maxFrontierMines; ++k)
+    {
+        const int nPooledMines = nRemainingMines - k;
+        if (nPooledMines >= 0 && nPooledMines <= nPooled)
+        {
+            maxLogWeight = std::max(maxLogWeight, logBinomial(nPooled, nPooledMines));
+        }
+    }
+    for (int k = 0; k <= maxFrontierMines; ++k)
+    {
+        const int nPooledMines = nRemainingMines - k;
+        if (nPooledMines >= 0 && nPooledMines <= nPooled)
+        {
+            interiorWeight[k] = std::exp(logBinomial(nPooled, nPooledMines) - maxLogWeight);
+        }
+    }
+
+    // PREFIX AND SUFFIX CONVOLUTIONS GIVE, FOR EVERY COMPONENT, THE MINE COUNT DISTRIBUTION OF ALL THE OTHERS
+    const size_t nSolved = solutions.size();
+    std::vector<std::vector<double>> prefix(nSolved + 1, std::vector<double>(1, 1.0));
+    std::vector<std::vector<double>> suffix(nSolved + 1, std::vector<double>(1, 1.0));
+    for (size_t i = 0; i < nSolved; ++i)
+    {
+        prefix[i + 1] = convolve(prefix[i], solutions[i]->solutions);
+        suffix[nSolved - 1 - i] = convolve(suffix[nSolved - i], solutions[nSolved - 1 - i]->solutions);
+    }
+    const std::vector<double>& total = prefix[nSolved];
+    double totalWeight = 0.0;
+    double pooledMineWeight = 0.0;
+    for (size_t k = 0; k < total.size(); ++k)
+    {
+        totalWeight += total[k] * interiorWeight[k];
+        pooledMineWeight += total[k] * interiorWeight[k] * (nRemainingMines - int(k));
+    }
+    if (totalWeight <= 0.0)
+    {
+        // NO LAYOUT FITS THE VISIBLE STATE (E.G. A WRONG FLAG), SO NOTHING BETTER THAN THE DENSITY IS KNOWN
+        exact = false;
+        for (const Component* component : solvedComponents)
+        {
+            for (int tile : component->tiles)
+            {
+                frontierProbability[tile] = density;
+            }
+        }
+        for (int tile : pooledFrontierTiles)
+        {
+            frontierProbability[tile] = density;
+        }
+        interiorProbability = density;
+    }
+    else {
+        for (size_t c = 0; c < nSolved; ++c)
+        {
+            const std::vector<double> others = convolve(prefix[c], suffix[c + 1]);
+            const Solution& solution = *solutions[c];
+            const std::vector<int>& tiles = solvedComponents[c]->tiles;
+            std::vector<double> probability(tiles.size(), 0.0);
+            for (size_t k = 0; k < solution.solutions.size(); ++k)
+            {
+                if (solution.hits[k].empty()) continue;
+                double weight = 0.0;
+                for (size_t j = 0; j < others.size(); ++j)
+                {
+                    weight += others[j] * interiorWeight[k + j];
+                }
+                for (size_t i = 0; i < tiles.size(); ++i)
+                {
+                    probability[i] += solution.hits[k][i] * weight;
+                }
+            }
+            for (size_t i = 0; i < tiles.size(); ++i)
+            {
+                frontierProbability[tiles[i]] = probability[i] / totalWeight;
+            }
+        }
+        interiorProbability = nPooled > 0 ? pooledMineWeight / totalWeight / nPooled : 0.0;
+        for (int tile : pooledFrontierTiles)
+        {
+            frontierProbability[tile] = interiorProbability;
+        }
+    }
+
+    if (nInterior > 0)
+    {
+        for (int index = 0; index < width * height && interiorTile < 0; ++index)
+        {
+            if (solver.getKnowledge({ index % width, index / width }) == Solver::Knowledge::Unknown &&
+                frontierProbability.find(index) == frontierProbability.end())
+            {
+                interiorTile = index;
+            }
+        }
+    }
+
+    for (auto it = solutionCache.begin(); it != solutionCache.end();)
+    {
+        it = it->second.lastUsed == computeCount ? std::next(it) : solutionCache.erase(it);
+    }
+}
+
+double ProbabilityEngine::getMineProbability(const Vei2& gridPos) const
+{
+    switch (solver.getKnowledge(gridPos))
+    {
+    case Solver::Knowledge::Mine:
+        return 1.0;
+    case Solver::Knowledge::Unknown:
+    {
+        const auto it = frontierProbability.find(gridPos.y * width + gridPos.x);
+        return it != frontierProbability.end() ? it->second : interiorProbability;
+    }
+    default:
+        return 0.0;
+    }
+}
+
+Vei2 ProbabilityEngine::getSafestTile() const
+{
+    int safest = interiorTile;
+    double lowest = interiorTile >= 0 ? interiorProbability : 2.0;
+    for (const auto& entry : frontierProbability)
+    {
+        if (entry.second < lowest || (entry.second == lowest && entry.first < safest))
+        {
+            lowest = entry.second;
+            safest = entry.first;
+        }
+    }
+    return safest >= 0 ? Vei2(safest % width, safest / width) : Vei2(-1, -1);
+}
+
+bool ProbabilityEngine::isExact() const
+{
+    return exact;
+}
+
+void ProbabilityEngine::collectComponents()
+{
+    // FRONTIER TILES ARE UNKNOWN TILES NEXT TO A REVEALED NUMBER; TWO OF THEM ARE IN THE SAME COMPONENT WHEN
+    // A CHAIN OF SHARED NUMBERS LINKS THEM (UNION-FIND OVER THE TILES OF EACH NUMBER)
+    std::unordered_map<int, int> frontierSlot;
+    std::vector<int> frontierTiles;
+    std::vector<int> parent;
+    std::vector<int> constraintIndices;
+    auto find = [&parent](int slot)
+    {
+        while (parent[slot] != slot)
+        {
+            slot = parent[slot] = parent[parent[slot]];
+        }
+        return slot;
+    };
+
+    for (int index = 0; index < width * height; ++index)
+    {
+        const Vei2 center(index % width, index / width);
+        if (solver.getKnowledge(center) != Solver::Knowledge::Revealed) continue;
+        int firstSlot = -1;
+        for (int dy = -1; dy <= 1; ++dy)
+        {
+            for (int dx = -1; dx <= 1; ++dx)
+            {
+                const Vei2 gridPos = center + Vei2(dx, dy);
+                if (!board.isWithinBoard(gridPos) || solver.getKnowledge(gridPos) != Solver::Knowledge::Unknown) continue;
+                const int tile = gridPos.y * width + gridPos.x;
+                auto inserted = frontierSlot.emplace(tile, int(frontierTiles.size()));
+                if (inserted.second)
+                {
+                    frontierTiles.push_back(tile);
+                    parent.push_back(inserted.first->second);
+                }
+                const int slot = inserted.first->second;
+                if (firstSlot < 0)
+                {
+                    firstSlot = slot;
+                }
+                else {
+                    parent[find(slot)] = find(firstSlot);
+                }
+            }
+        }
+        if (firstSlot >= 0)
+        {
+            constraintIndices.push_back(index);
+        }
+    }
+
+    // GROUP THE TILES AND NUMBERS BY ROOT, THEN ORDER EACH COMPONENT'S TILES BREADTH FIRST THROUGH ITS NUMBERS SO
+    // THE SEARCH CLOSES CONSTRAINTS EARLY AND PRUNES SOONER
+    std::unordered_map<int, int> componentOfRoot;
+    std::vector<std::vector<int>> componentConstraints;
+    for (int index : constraintIndices)
+    {
+        const Vei2 center(index % width, index / width);
+        int root = -1;
+        for (int dy = -1; dy <= 1 && root < 0; ++dy)
+        {
+            for (int dx = -1; dx <= 1 && root < 0; ++dx)
+            {
+                const Vei2 gridPos = center + Vei2(dx, dy);
+                if (board.isWithinBoard(gridPos) && solver.getKnowledge(gridPos) == Solver::Knowledge::Unknown)
+                {
+                    root = find(frontierSlot[gridPos.y * width + gridPos.x]);
+                }
+            }
+        }
+        auto inserted = componentOfRoot.emplace(root, int(componentConstraints.size()));
+        if (inserted.second)
+        {
+            componentConstraints.emplace_back();
+        }
+        componentConstraints[inserted.first->second].push_back(index);
+    }
+
+    components.clear();
+    components.resize(componentConstraints.size());
+    for (size_t c = 0; c < componentConstraints.size(); ++c)
+    {
+        Component& component = components[c];
+        const std::vector<int>& constraints = componentConstraints[c];
+        std::unordered_map<int, int> localIndex;
+        std::vector<std::vector<int>> globalTilesOfConstraint(constraints.size());
+        std::unordered_map<int, std::vector<int>> constraintsOfTile;
+        for (size_t i = 0; i < constraints.size(); ++i)
+        {
+            const Vei2 center(constraints[i] % width, constraints[i] / width);
+            int required = board.getNumberOfAdjacentMines(center);
+            for (int dy = -1; dy <= 1; ++dy)
+            {
+                for (int dx = -1; dx <= 1; ++dx)
+                {
+                    const Vei2 gridPos = center + Vei2(dx, dy);
+                    if (!board.isWithinBoard(gridPos)) continue;
+                    const Solver::Knowledge knowledge = solver.getKnowledge(gridPos);
+                    if (knowledge == Solver::Knowledge::Mine)
+                    {
+                        --required;
+                    }
+                    else if (knowledge == Solver::Knowledge::Unknown)
+                    {
+                        const int tile = gridPos.y * width + gridPos.x;
+                        globalTilesOfConstraint[i].push_back(tile);
+                        constraintsOfTile[tile].push_back(int(i));
+                    }
+                }
+            }
+            component.required.push_back(required);
+        }
+
+        std::vector<unsigned char> isConstraintQueued(constraints.size(), 0);
+        const int firstTile = globalTilesOfConstraint[0][0];
+        localIndex[firstTile] = 0;
+        component.tiles.push_back(firstTile);
+        for (size_t next = 0; next < component.tiles.size(); ++next)
+        {
+            for (int constraint : constraintsOfTile[component.tiles[next]])
+            {
+                if (isConstraintQueued[constraint]) continue;
+                isConstraintQueued[constraint] = 1;
+                for (int tile : globalTilesOfConstraint[constraint])
+                {
+                    if (localIndex.emplace(tile, int(component.tiles.size())).second)
+                    {
+                        component.tiles.push_back(tile);
+                    }
+                }
+            }
+        }
+        for (const std::vector<int>& tiles : globalTilesOfConstraint)
+        {
+            component.constraintTiles.emplace_back();
+            for (int tile : tiles)
+            {
+                component.constraintTiles.back().push_back(localIndex[tile]);
+            }
+        }
+    }
+}
+
+std::vector<int> ProbabilityEngine::makeKey(const Component& component) const
+{
+    std::vector<int> key(component.tiles);
+    for (size_t i = 0; i < component.required.size(); ++i)
+    {
+        key.push_back(-1);
+        key.push_back(component.required[i]);
+        key.insert(key.end(), component.constraintTiles[i].begin(), component.constraintTiles[i].end());
+    }
+    return key;
+}
+
+ProbabilityEngine::Solution ProbabilityEngine::enumerate(const Component& component) const
+{
+    const int nTiles = int(component.tiles.size());
+    const int nConstraints = int(component.required.size());
+    std::vector<std::vector<int>> constraintsOfTile(nTiles);
+    std::vector<int> nUnassigned(nConstraints);
+    std::vector<int> nAssignedMines(nConstraints, 0);
+    for (int c = 0; c < nConstraints; ++c)
+    {
+        nUnassigned[c] = int(component.constraintTiles[c].size());
+        for (int tile : component.constraintTiles[c])
+        {
+            constraintsOfTile[tile].push_back(c);
+        }
+    }
+
+    Solution solution;
+    solution.solutions.assign(nTiles + 1, 0.0);
+    solution.hits.resize(nTiles + 1);
+
+    // ITERATIVE DEPTH-FIRST SEARCH OVER THE TILES IN ORDER, TRYING "NO MINE" THEN "MINE". AN ASSIGNMENT IS
+    // ONLY MADE WHEN EVERY NUMBER TOUCHING THE TILE CAN STILL BE MET BY ITS REMAINING TILES
+    std::vector<signed char> tried(nTiles, -1);
+    std::vector<unsigned char> applied(nTiles, 0);
+    int nMines = 0;
+    long long nNodes = 0;
+    int pos = 0;
+    while (pos >= 0)
+    {
+        if (pos == nTiles)
+        {
+            solution.solutions[nMines] += 1.0;
+            std::vector<double>& hits = solution.hits[nMines];
+            if (hits.empty())
+            {
+                hits.assign(nTiles, 0.0);
+            }
+            for (int i = 0; i < nTiles; ++i)
+            {
+                hits[i] += tried[i];
+            }
+            --pos;
+            continue;
+        }
+        if (applied[pos])
+        {
+            for (int c : constraintsOfTile[pos])
+            {
+                ++nUnassigned[c];
+                nAssignedMines[c] -= tried[pos];
+            }
+            nMines -= tried[pos];
+            applied[pos] = 0;
+        }
+        const int value = tried[pos] + 1;
+        if (value > 1)
+        {
+            tried[pos] = -1;
+            --pos;
+            continue;
+        }
+        tried[pos] = (signed char)value;
+        if (++nNodes > nodeBudget)
+        {
+            solution.isExact = false;
+            return solution;
+        }
+        bool isFeasible = true;
+        for (int c : constraintsOfTile[pos])
+        {
+            const int nMinesAfter = nAssignedMines[c] + value;
+            isFeasible &= nMinesAfter <= component.required[c] && nMinesAfter + nUnassigned[c] - 1 >= component.required[c];
+        }
+        if (isFeasible)
+        {
+            for (int c : constraintsOfTile[pos])
+            {
+                --nUnassigned[c];
+                nAssignedMines[c] += value;
+            }
+            nMines += value;
+            applied[pos] = 1;
+            ++pos;
+        }
+    }
+
+    // NORMALIZE SO PRODUCTS OVER MANY COMPONENTS STAY IN RANGE
+    double nSolutions = 0.0;
+    for (double count : solution.solutions)
+    {
+        nSolutions += count;
+    }
+    if (nSolutions > 0.0)
+    {
+        for (size_t k = 0; k < solution.solutions.size(); ++k)
+        {
+            solution.solutions[k] /= nSolutions;
+            for (double& hits : solution.hits[k])
+            {
+                hits /= nSolutions;
+            }
+        }
+    }
+    return solution;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "Board.h"
+#include "Solver.h"
+#include "Vei2.h"
+#include <vector>
+#include <map>
+#include <unordered_map>
+
+// EXACT MINE PROBABILITIES FOR THE HIDDEN TILES OF A BOARD, GIVEN WHAT THE SOLVER ALREADY KNOWS.
+// THE FRONTIER (UNKNOWN TILES NEXT TO REVEALED NUMBERS) IS SPLIT INTO INDEPENDENT COMPONENTS, EACH ONE IS
+// ENUMERATED BY BACKTRACKING INTO SOLUTION COUNTS PER NUMBER OF MINES, AND THE COMPONENTS ARE COMBINED
+// WITH THE NUMBER OF WAYS TO SPREAD THE REMAINING MINES OVER THE TILES AWAY FROM THE FRONTIER
+class ProbabilityEngine
+{
+public:
+	// A COMPONENT THAT NEEDS MORE THAN nodeBudget SEARCH STEPS IS GIVEN UP ON, WHICH BOUNDS THE TIME OF compute().
+	// ITS TILES ARE THEN COUNTED WITH THE TILES AWAY FROM THE FRONTIER: THE MINES THE SOLVED COMPONENTS LEAVE OVER
+	// ARE SPREAD EVENLY OVER BOTH, AS IF THE NUMBERS AROUND THE GIVEN-UP TILES DID NOT CONSTRAIN THEM
+	ProbabilityEngine(const Board& _board, const Solver& _solver, long long _nodeBudget = 1 << 20);
+	void compute();
+	// PROBABILITY THAT A TILE IS A MINE: 0 FOR REVEALED AND DEDUCED SAFE TILES, 1 FOR DEDUCED MINES
+	double getMineProbability(const Vei2& gridPos) const;
+	// HIDDEN TILE WITH THE LOWEST MINE PROBABILITY, (-1, -1) IF THERE IS NONE
+	Vei2 getSafestTile() const;
+	// FALSE WHEN A COMPONENT EXCEEDED THE NODE BUDGET AND ITS TILES ONLY HAVE THE FALLBACK ESTIMATE
+	bool isExact() const;
+private:
+	struct Component
+	{
+		// GLOBAL TILE INDICES OF THE FRONTIER TILES, IN SEARCH ORDER
+		std::vector<int> tiles;
+		// REVEALED NUMBERS TOUCHING THE COMPONENT: MINES STILL NEEDED AND THE LOCAL INDICES OF THEIR TILES
+		std::vector<int> required;
+		std::vector<std::vector<int>> constraintTiles;
+	};
+	struct Solution
+	{
+		// solutions[k]: NUMBER OF VALID MINE LAYOUTS WITH k MINES, hits[k][i]: HOW MANY OF THOSE HAVE A MINE
+		// ON TILE i (EMPTY WHEN THERE ARE NONE). BOTH ARE SCALED BY THE SAME FACTOR, WHICH CANCELS OUT
+		std::vector<double> solutions;
+		std::vector<std::vector<double>> hits;
+		bool isExact = true;
+		int lastUsed = 0;
+	};
+private:
+	void collectComponents();
+	std::vector<int> makeKey(const Component& component) const;
+	Solution enumerate(const Component& component) const;
+private:
+	const Board& board;
+	const Solver& solver;
+	long long nodeBudget;
+	int width;
+	int height;
+	std::vector<Component> components;
+	// SOLUTIONS OF PREVIOUS CALLS, SO COMPONENTS A MOVE DID NOT TOUCH ARE NOT ENUMERATED AGAIN
+	std::map<std::vector<int>, Solution> solutionCache;
+	int computeCount = 0;
+	std::unordered_map<int, double> frontierProbability;
+	double interiorProbability = 0.0;
+	int interiorTile = -1;
+	bool exact = true;
+};
@@ -0,0 +1,55 @@
+#include "Replay.h"
+#include <assert.h>
+#include <algorithm>
+
+Replay::Replay(const MoveLog& _log, long long _checkpointInterval)
+    :log(_log), checkpointInterval(_checkpointInterval),
+    board(_log.getWidth(), _log.getHeight(), _log.getNumberOfMines(), _log.getSeed())
+{
+    assert(_checkpointInterval > 0);
+    checkpoints.push_back({ cursor, board });
+}
+
+void Replay::seek(long long nEvents)
+{
+    nEvents = std::max(0ll, std::min(nEvents, log.getNumberOfEvents()));
+    const size_t nearest = std::min(size_t(nEvents / checkpointInterval), checkpoints.size() - 1);
+    const Checkpoint& checkpoint = checkpoints[nearest];
+    if (nEvents < cursor.nEvents || checkpoint.cursor.nEvents > cursor.nEvents)
+    {
+        // SAME SIZE, SO THIS COPIES INTO THE MEMORY THE BOARD ALREADY HAS
+        board = checkpoint.board;
+        cursor = checkpoint.cursor;
+    }
+    while (cursor.nEvents < nEvents && step())
+    {
+    }
+}
+
+bool Replay::step()
+{
+    MoveLog::Event event;
+    if (!log.next(cursor, event)) return false;
+    if (event.isFlag)
+    {
+        board.flagTile(event.gridPos);
+    }
+    else {
+        board.revealTile(event.gridPos);
+    }
+    if (cursor.nEvents % checkpointInterval == 0 && size_t(cursor.nEvents / checkpointInterval) == checkpoints.size())
+    {
+        checkpoints.push_back({ cursor, board });
+    }
+    return true;
+}
+
+long long Replay::getPosition() const
+{
+    return cursor.nEvents;
+}
+
+const Board& Replay::getBoard() const
+{
+    return board;
+}
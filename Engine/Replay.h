@@ -0,0 +1,34 @@
+#pragma once
+#include "Board.h"
+#include "MoveLog.h"
+#include <vector>
+
+// REBUILDS THE STATE OF A LOGGED GAME AFTER ANY NUMBER OF EVENTS BY APPLYING THE EVENTS TO A FRESH BOARD.
+// WHILE REPLAYING FORWARD IT KEEPS A COPY OF THE BOARD EVERY checkpointInterval EVENTS, SO SEEKING BACKWARDS,
+// OR FORWARDS PAST A CHECKPOINT ALREADY TAKEN, ONLY REPLAYS FROM THE NEAREST CHECKPOINT BEFORE THE TARGET
+class Replay
+{
+public:
+	// THE LOG MUST OUTLIVE THE REPLAY; EVENTS RECORDED AFTER CONSTRUCTION ARE PICKED UP
+	Replay(const MoveLog& _log, long long _checkpointInterval = 65536);
+	// MOVES TO THE STATE AFTER THE FIRST nEvents EVENTS (CLAMPED TO THE LENGTH OF THE LOG)
+	void seek(long long nEvents);
+	// APPLIES THE NEXT EVENT; FALSE AT THE END OF THE LOG OR AT AN EVENT THAT CANNOT BE DECODED, WHICH IS NOT
+	// APPLIED AND STOPS THE REPLAY THERE
+	bool step();
+	long long getPosition() const;
+	const Board& getBoard() const;
+private:
+	struct Checkpoint
+	{
+		MoveLog::Cursor cursor;
+		Board board;
+	};
+private:
+	const MoveLog& log;
+	long long checkpointInterval;
+	Board board;
+	MoveLog::Cursor cursor;
+	// checkpoints[i] IS THE STATE AFTER i * checkpointInterval EVENTS, STARTING WITH THE FRESH BOARD
+	std::vector<Checkpoint> checkpoints;
+};
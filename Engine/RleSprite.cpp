@@ -0,0 +1,129 @@
+#include "RleSprite.h"
+#include <assert.h>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RLE_SPRITE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    void fillSpan(Color* pDst, int length, Color color)
+    {
+        int i = 0;
+#ifdef RLE_SPRITE_SSE2
+        const __m128i colors = _mm_set1_epi32(int(color.dword));
+        for (; i + 4 <= length; i += 4)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i), colors);
+        }
+#endif
+        for (; i < length; ++i)
+        {
+            pDst[i] = color;
+        }
+    }
+
+    // MOST COPY SPANS ARE A FEW PIXELS LONG, WHERE A CALL TO memcpy WOULD COST MORE THAN THE COPY ITSELF
+    void copySpan(Color* pDst, const Color* pSrc, int length)
+    {
+        int i = 0;
+#ifdef RLE_SPRITE_SSE2
+        for (; i + 4 <= length; i += 4)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i)));
+        }
+#endif
+        for (; i < length; ++i)
+        {
+            pDst[i] = pSrc[i];
+        }
+    }
+}
+
+RleSprite::RleSprite(const Color* pSrc, int srcPitch, int _width, int _height, Color chroma)
+    :width(_width), height(_height)
+{
+    assert(_width > 0 && _width <= INT16_MAX && _height > 0 && _height <= INT16_MAX);
+    for (int y = 0; y < height; ++y)
+    {
+        const Color* row = pSrc + size_t(srcPitch) * y;
+        int x = 0;
+        while (x < width)
+        {
+            if (row[x].dword == chroma.dword)
+            {
+                ++x;
+                continue;
+            }
+            // A RUN OF ONE COLOR, AND EITHER A FILL OF IT OR PIXELS FOR A COPY SPAN THAT GROWS UNTIL THE NEXT FILL
+            int end = x + 1;
+            while (end < width && row[end].dword == row[x].dword)
+            {
+                ++end;
+            }
+            if (end - x >= MIN_FILL_LENGTH)
+            {
+                spans.push_back({ int16_t(x), int16_t(y), int16_t(end - x), true, row[x].dword });
+            }
+            else {
+                const bool extendsCopy = !spans.empty() && !spans.back().isFill && spans.back().y == y
+                    && spans.back().x + spans.back().length == x;
+                if (!extendsCopy)
+                {
+                    spans.push_back({ int16_t(x), int16_t(y), 0, false, uint32_t(pixels.size()) });
+                }
+                spans.back().length += int16_t(end - x);
+                pixels.insert(pixels.end(), row + x, row + end);
+            }
+            x = end;
+        }
+    }
+    // SPANS NEVER OVERLAP, SO THEIR ORDER IS FREE: THE FILLS GO FIRST AND DRAWING DOES NOT BRANCH ON THE KIND
+    nFillSpans = int(std::stable_partition(spans.begin(), spans.end(), [](const Span& span) { return span.isFill; })
+        - spans.begin());
+}
+
+void RleSprite::draw(Color* pDst, int dstPitch, int dstWidth, int dstHeight, int x, int y) const
+{
+    const bool isClipped = x < 0 || y < 0 || x + width > dstWidth || y + height > dstHeight;
+    for (int i = 0; i < int(spans.size()); ++i)
+    {
+        const Span& span = spans[i];
+        const int row = y + span.y;
+        int left = x + span.x;
+        int right = left + span.length;
+        if (isClipped)
+        {
+            if (row < 0 || row >= dstHeight) continue;
+            left = std::max(left, 0);
+            right = std::min(right, dstWidth);
+            if (left >= right) continue;
+        }
+        Color* const pSpan = pDst + size_t(dstPitch) * row + left;
+        if (i < nFillSpans)
+        {
+            fillSpan(pSpan, right - left, Color(span.data));
+        }
+        else {
+            copySpan(pSpan, pixels.data() + span.data + (left - x - span.x), right - left);
+        }
+    }
+}
+
+int RleSprite::getWidth() const
+{
+    return width;
+}
+
+int RleSprite::getHeight() const
+{
+    return height;
+}
+
+int RleSprite::getNumberOfSpans() const
+{
+    return int(spans.size());
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "Colors.h"
+#include <cstdint>
+#include <vector>
+
+// A SPRITE STORED AS THE HORIZONTAL SPANS OF ITS VISIBLE PIXELS, ROW BY ROW. A RUN OF AT LEAST MIN_FILL_LENGTH
+// PIXELS OF ONE COLOR BECOMES A FILL SPAN, THE REST OF A VISIBLE RUN BECOMES A COPY SPAN, AND TRANSPARENT PIXELS
+// ARE NOT STORED AT ALL, SO DRAWING NEVER LOOKS AT THEM
+class RleSprite
+{
+public:
+	RleSprite() = default;
+	// ENCODES A width x height BLOCK OF PIXELS (srcPitch APART FROM ROW TO ROW) WHOSE chroma PIXELS ARE TRANSPARENT
+	RleSprite(const Color* pSrc, int srcPitch, int _width, int _height, Color chroma);
+	// DRAWS THE SPRITE WITH ITS TOP LEFT AT x, y INTO A dstWidth x dstHeight IMAGE, CLIPPED TO IT
+	void draw(Color* pDst, int dstPitch, int dstWidth, int dstHeight, int x, int y) const;
+	int getWidth() const;
+	int getHeight() const;
+	int getNumberOfSpans() const;
+private:
+	struct Span
+	{
+		int16_t x;
+		int16_t y;
+		int16_t length;
+		bool isFill;
+		// THE COLOR OF A FILL SPAN, THE OFFSET OF ITS FIRST PIXEL IN pixels FOR A COPY SPAN
+		uint32_t data;
+	};
+private:
+	static constexpr int MIN_FILL_LENGTH = 8;
+private:
+	int width = 0;
+	int height = 0;
+	// THE FIRST nFillSpans SPANS ARE THE FILLS
+	std::vector<Span> spans;
+	int nFillSpans = 0;
+	std::vector<Color> pixels;
+};
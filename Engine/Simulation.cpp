@@ -0,0 +1,172 @@
+#include "Simulation.h"
+#include "Solver.h"
+#include "ProbabilityEngine.h"
+#include <assert.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace
+{
+    // THE RANDOM STRATEGY'S STREAM IS SEEDED WITH THE GAME SEED XORED WITH THIS KEY, SO IT NEVER RUNS ALONG THE
+    // STREAM Board DRAWS THE MINES FROM
+    constexpr uint64_t STRATEGY_STREAM_KEY = 0xD1B54A32D192ED03u;
+
+    uint64_t nanosecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count());
+    }
+
+    int highestBit(uint64_t value)
+    {
+        int bit = 0;
+        while (value >>= 1)
+        {
+            ++bit;
+        }
+        return bit;
+    }
+}
+
+void LatencyHistogram::record(uint64_t nanoseconds)
+{
+    // VALUES BELOW 2^SUB_BUCKET_BITS GET A BUCKET EACH; ABOVE THAT, THE LEADING BIT PICKS THE OCTAVE AND THE
+    // NEXT SUB_BUCKET_BITS BITS THE STEP WITHIN IT
+    int bucket;
+    if (nanoseconds < (1u << SUB_BUCKET_BITS))
+    {
+        bucket = int(nanoseconds);
+    }
+    else {
+        const int octave = highestBit(nanoseconds) - SUB_BUCKET_BITS;
+        bucket = ((octave + 1) << SUB_BUCKET_BITS) + int((nanoseconds >> octave) & ((1u << SUB_BUCKET_BITS) - 1));
+    }
+    assert(bucket >= 0 && bucket < N_BUCKETS);
+    ++counts[bucket];
+    ++count;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other)
+{
+    for (int i = 0; i < N_BUCKETS; ++i)
+    {
+        counts[i] += other.counts[i];
+    }
+    count += other.count;
+}
+
+double LatencyHistogram::getPercentile(double percentile) const
+{
+    if (count == 0) return 0.0;
+    const long long rank = std::max(1ll, (long long)std::ceil(percentile / 100.0 * count));
+    long long seen = 0;
+    int bucket = 0;
+    while (bucket < N_BUCKETS - 1 && (seen += counts[bucket]) < rank)
+    {
+        ++bucket;
+    }
+    if (bucket < (1 << SUB_BUCKET_BITS)) return double(bucket);
+    const int octave = (bucket >> SUB_BUCKET_BITS) - 1;
+    const uint64_t low = (uint64_t((1 << SUB_BUCKET_BITS) + (bucket & ((1 << SUB_BUCKET_BITS) - 1)))) << octave;
+    return double(low) + double(uint64_t(1) << octave) / 2.0;
+}
+
+long long LatencyHistogram::getCount() const
+{
+    return count;
+}
+
+Simulation::Simulation(int _width, int _height, int _nMines, Strategy _strategy)
+    :width(_width), height(_height), nMines(_nMines), strategy(_strategy)
+{
+}
+
+bool Simulation::play(uint64_t seed)
+{
+    Board board(width, height, nMines, seed);
+    return play(board, seed);
+}
+
+bool Simulation::play(Board& board, uint64_t seed)
+{
+    assert(!board.minesPlaced());
+    // THE RANDOM STRATEGY DRAWS FROM ITS OWN STREAM, SEPARATE FROM THE ONE THAT PLACES THE MINES
+    SplitMix64 rng(SplitMix64::at(seed ^ STRATEGY_STREAM_KEY, 0));
+    const bool isWon = strategy == Strategy::Random ? playRandom(board, rng) : playSolver(board);
+    ++nGames;
+    nWins += isWon;
+    return isWon;
+}
+
+bool Simulation::playRandom(Board& board, SplitMix64& rng)
+{
+    for (bool isFirstMove = true; !board.mineTriggered() && !board.allTilesRevealed(); isFirstMove = false)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        Vei2 gridPos(width / 2, height / 2);
+        while (!isFirstMove && board.isRevealed(gridPos))
+        {
+            gridPos = Vei2(int(rng.nextBelow(uint32_t(width))), int(rng.nextBelow(uint32_t(height))));
+        }
+        board.revealTile(gridPos);
+        moveLatencies.record(nanosecondsSince(start));
+        ++nMoves;
+    }
+    return !board.mineTriggered();
+}
+
+bool Simulation::playSolver(Board& board)
+{
+    Solver solver(board);
+    ProbabilityEngine probabilities(board, solver);
+    for (bool isFirstMove = true; !board.mineTriggered() && !board.allTilesRevealed(); isFirstMove = false)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        Vei2 gridPos(width / 2, height / 2);
+        if (!isFirstMove)
+        {
+            solver.update();
+            if (!solver.getSafeTiles().empty())
+            {
+                gridPos = solver.getSafeTiles().back();
+            }
+            else {
+                probabilities.compute();
+                gridPos = probabilities.getSafestTile();
+            }
+        }
+        board.revealTile(gridPos);
+        moveLatencies.record(nanosecondsSince(start));
+        ++nMoves;
+    }
+    return !board.mineTriggered();
+}
+
+void Simulation::merge(const Simulation& other)
+{
+    nGames += other.nGames;
+    nWins += other.nWins;
+    nMoves += other.nMoves;
+    moveLatencies.merge(other.moveLatencies);
+}
+
+long long Simulation::getNumberOfGames() const
+{
+    return nGames;
+}
+
+long long Simulation::getNumberOfWins() const
+{
+    return nWins;
+}
+
+long long Simulation::getNumberOfMoves() const
+{
+    return nMoves;
+}
+
+const LatencyHistogram& Simulation::getMoveLatencies() const
+{
+    return moveLatencies;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "Board.h"
+#include "SplitMix64.h"
+#include "Vei2.h"
+#include <cstdint>
+
+// PLAYS GAMES WITHOUT A WINDOW FOR BENCHMARKING, AND COUNTS WINS, MOVES AND HOW LONG EACH MOVE TOOK.
+// A MOVE IS CHOOSING A TILE AND REVEALING IT. EVERY GAME ONLY DEPENDS ON ITS SEED, SO RESULTS REPRODUCE
+enum class Strategy
+{
+	// REVEAL A HIDDEN TILE AT RANDOM
+	Random,
+	// REVEAL THE TILES THE SOLVER PROVES SAFE, AND GUESS THE SAFEST TILE BY EXACT PROBABILITY WHEN IT IS STUCK
+	Solver
+};
+
+// MOVE TIMES IN NANOSECONDS, BUCKETED BY POWERS OF TWO SPLIT INTO 16 STEPS, SO A PERCENTILE IS ACCURATE TO
+// ABOUT 6% IN CONSTANT MEMORY HOWEVER MANY MOVES ARE RECORDED, AND HISTOGRAMS OF SEVERAL THREADS CAN BE ADDED
+class LatencyHistogram
+{
+public:
+	void record(uint64_t nanoseconds);
+	void merge(const LatencyHistogram& other);
+	// percentile IN [0, 100]; THE MIDDLE OF THE BUCKET THAT HOLDS IT, 0 WHEN NOTHING WAS RECORDED
+	double getPercentile(double percentile) const;
+	long long getCount() const;
+private:
+	static constexpr int SUB_BUCKET_BITS = 4;
+	static constexpr int N_BUCKETS = 64 << SUB_BUCKET_BITS;
+private:
+	long long counts[N_BUCKETS] = {};
+	long long count = 0;
+};
+
+class Simulation
+{
+public:
+	Simulation(int _width, int _height, int _nMines, Strategy _strategy);
+	// PLAYS ONE GAME FROM THE CENTER TILE, ON A BOARD THAT PLACES ITS MINES FROM seed
+	bool play(uint64_t seed);
+	// PLAYS ONE GAME ON A BOARD THAT HAS NOT BEEN REVEALED YET
+	bool play(Board& board, uint64_t seed);
+	void merge(const Simulation& other);
+	long long getNumberOfGames() const;
+	long long getNumberOfWins() const;
+	long long getNumberOfMoves() const;
+	const LatencyHistogram& getMoveLatencies() const;
+private:
+	bool playRandom(Board& board, SplitMix64& rng);
+	bool playSolver(Board& board);
+private:
+	int width;
+	int height;
+	int nMines;
+	Strategy strategy;
+	long long nGames = 0;
+	long long nWins = 0;
+	long long nMoves = 0;
+	LatencyHistogram moveLatencies;
+};
@@ -0,0 +1,271 @@
+#include "Solver.h"
+#include <assert.h>
+#include <algorithm>
+
+Solver::Solver(const Board& _board)
+    :board(_board), width(_board.getWidth()), height(_board.getHeight()),
+    knowledge(size_t(_board.getWidth()) * _board.getHeight(), Knowledge::Unknown),
+    seenRevealed(_board.getWidth(), _board.getHeight()), seenFlagged(_board.getWidth(), _board.getHeight()),
+    isConstraintPending(size_t(_board.getWidth()) * _board.getHeight(), 0)
+{
+}
+
+void Solver::update()
+{
+    // AN UNFLAGGED OR UN-REVEALED TILE (A REMOVED FLAG, OR A MOVE UNDONE WITH Board::revert) CAN INVALIDATE ANY
+    // DEDUCTION, SO START OVER AND ABSORB THE WHOLE VISIBLE STATE AS A FRESH SOLVER WOULD
+    if (hasRemovedTiles(board.getRevealedTiles(), seenRevealed) || hasRemovedTiles(board.getFlaggedTiles(), seenFlagged))
+    {
+        std::fill(knowledge.begin(), knowledge.end(), Knowledge::Unknown);
+        seenRevealed.clear();
+        seenFlagged.clear();
+        pendingConstraints.clear();
+        std::fill(isConstraintPending.begin(), isConstraintPending.end(), 0);
+        safeTiles.clear();
+        mines.clear();
+    }
+    absorbChangedWords(board.getRevealedTiles(), seenRevealed, Knowledge::Revealed);
+    absorbChangedWords(board.getFlaggedTiles(), seenFlagged, Knowledge::Mine);
+
+    Constraint constraint;
+    while (!pendingConstraints.empty())
+    {
+        const int index = pendingConstraints.back();
+        pendingConstraints.pop_back();
+        isConstraintPending[index] = 0;
+        if (buildConstraint(index, constraint))
+        {
+            applySinglePointRule(constraint);
+            applySubsetRule(index, constraint);
+        }
+    }
+
+    safeTiles.erase(std::remove_if(safeTiles.begin(), safeTiles.end(), [this](const Vei2& gridPos)
+    {
+        return getKnowledge(gridPos) == Knowledge::Revealed;
+    }), safeTiles.end());
+}
+
+Solver::Knowledge Solver::getKnowledge(const Vei2& gridPos) const
+{
+    assert(board.isWithinBoard(gridPos));
+    return knowledge[size_t(gridPos.y) * width + gridPos.x];
+}
+
+const std::vector<Vei2>& Solver::getSafeTiles() const
+{
+    return safeTiles;
+}
+
+const std::vector<Vei2>& Solver::getMines() const
+{
+    return mines;
+}
+
+bool Solver::hasRemovedTiles(const BitPlane& boardPlane, const BitPlane& seenPlane) const
+{
+    const int wordsPerRow = boardPlane.getWordsPerRow();
+    for (int y = 0; y < height; ++y)
+    {
+        const uint64_t* boardRow = boardPlane.row(y);
+        const uint64_t* seenRow = seenPlane.row(y);
+        for (int k = 0; k < wordsPerRow; ++k)
+        {
+            if (seenRow[k] & ~boardRow[k]) return true;
+        }
+    }
+    return false;
+}
+
+void Solver::absorbChangedWords(const BitPlane& boardPlane, BitPlane& seenPlane, Knowledge newKnowledge)
+{
+    // ONLY WORDS THAT DIFFER FROM THE LAST SEEN COPY HOLD NEW TILES, SO AN UNCHANGED BOARD COSTS ONE
+    // COMPARISON PER 64 TILES
+    const int wordsPerRow = boardPlane.getWordsPerRow();
+    for (int y = 0; y < height; ++y)
+    {
+        const uint64_t* boardRow = boardPlane.row(y);
+        uint64_t* seenRow = seenPlane.row(y);
+        for (int k = 0; k < wordsPerRow; ++k)
+        {
+            uint64_t added = boardRow[k] & ~seenRow[k];
+            seenRow[k] = boardRow[k];
+            while (added != 0)
+            {
+                const int x = k * 64 + countTrailingZeros(added);
+                added &= added - 1;
+                const int index = y * width + x;
+                if (newKnowledge == Knowledge::Revealed && board.hasMine({ x, y }))
+                {
+                    // A REVEALED MINE ENDS THE GAME; ITS COUNT IS NOT A CONSTRAINT
+                    markTile(index, Knowledge::Mine);
+                }
+                else if (newKnowledge == Knowledge::Revealed || knowledge[index] == Knowledge::Unknown)
+                {
+                    markTile(index, newKnowledge);
+                }
+            }
+        }
+    }
+}
+
+void Solver::markTile(int index, Knowledge newKnowledge)
+{
+    if (knowledge[index] == newKnowledge) return;
+    knowledge[index] = newKnowledge;
+
+    const Vei2 gridPos(index % width, index / width);
+    if (newKnowledge == Knowledge::Safe)
+    {
+        safeTiles.push_back(gridPos);
+    }
+    else if (newKnowledge == Knowledge::Mine)
+    {
+        mines.push_back(gridPos);
+    }
+    else if (newKnowledge == Knowledge::Revealed)
+    {
+        queueConstraint(index);
+    }
+    queueNeighborConstraints(index);
+}
+
+void Solver::queueNeighborConstraints(int index)
+{
+    const int x = index % width;
+    const int y = index / width;
+    int xStart = std::max(0, x - 1);
+    int xEnd = std::min(width - 1, x + 1);
+    int yStart = std::max(0, y - 1);
+    int yEnd = std::min(height - 1, y + 1);
+    for (int ny = yStart; ny <= yEnd; ++ny)
+    {
+        for (int nx = xStart; nx <= xEnd; ++nx)
+        {
+            queueConstraint(ny * width + nx);
+        }
+    }
+}
+
+void Solver::queueConstraint(int index)
+{
+    if (knowledge[index] == Knowledge::Revealed && !isConstraintPending[index])
+    {
+        isConstraintPending[index] = 1;
+        pendingConstraints.push_back(index);
+    }
+}
+
+bool Solver::buildConstraint(int index, Constraint& constraint) const
+{
+    if (knowledge[index] != Knowledge::Revealed) return false;
+
+    const int x = index % width;
+    const int y = index / width;
+    constraint.nTiles = 0;
+    constraint.nMines = board.getNumberOfAdjacentMines({ x, y });
+    int xStart = std::max(0, x - 1);
+    int xEnd = std::min(width - 1, x + 1);
+    int yStart = std::max(0, y - 1);
+    int yEnd = std::min(height - 1, y + 1);
+    for (int ny = yStart; ny <= yEnd; ++ny)
+    {
+        for (int nx = xStart; nx <= xEnd; ++nx)
+        {
+            const int neighbor = ny * width + nx;
+            if (knowledge[neighbor] == Knowledge::Unknown)
+            {
+                constraint.tiles[constraint.nTiles++] = neighbor;
+            }
+            else if (knowledge[neighbor] == Knowledge::Mine)
+            {
+                --constraint.nMines;
+            }
+        }
+    }
+    return constraint.nTiles > 0;
+}
+
+void Solver::applySinglePointRule(const Constraint& constraint)
+{
+    if (constraint.nMines == 0)
+    {
+        for (int i = 0; i < constraint.nTiles; ++i)
+        {
+            markTile(constraint.tiles[i], Knowledge::Safe);
+        }
+    }
+    else if (constraint.nMines == constraint.nTiles)
+    {
+        for (int i = 0; i < constraint.nTiles; ++i)
+        {
+            markTile(constraint.tiles[i], Knowledge::Mine);
+        }
+    }
+}
+
+void Solver::applySubsetRule(int index, const Constraint& constraint)
+{
+    // FOR TWO NUMBERS A AND B SHARING UNKNOWN TILES: IF B NEEDS AS MANY MORE MINES THAN A AS IT HAS TILES A
+    // CANNOT SEE, THOSE TILES ARE ALL MINES AND A'S TILES THAT B CANNOT SEE ARE ALL SAFE. WITH A'S TILES A
+    // SUBSET OF B'S THIS IS THE CLASSIC SUBSET RULE, AND IT ALSO COVERS OVERLAPS SUCH AS 1-2-1
+    const int x = index % width;
+    const int y = index / width;
+    int xStart = std::max(0, x - 2);
+    int xEnd = std::min(width - 1, x + 2);
+    int yStart = std::max(0, y - 2);
+    int yEnd = std::min(height - 1, y + 2);
+    Constraint other;
+    for (int ny = yStart; ny <= yEnd; ++ny)
+    {
+        for (int nx = xStart; nx <= xEnd; ++nx)
+        {
+            const int otherIndex = ny * width + nx;
+            if (otherIndex == index || !buildConstraint(otherIndex, other)) continue;
+
+            int onlyThis[8];
+            int onlyOther[8];
+            int nOnlyThis = 0;
+            int nOnlyOther = 0;
+            for (int i = 0; i < constraint.nTiles; ++i)
+            {
+                if (!other.contains(constraint.tiles[i]))
+                {
+                    onlyThis[nOnlyThis++] = constraint.tiles[i];
+                }
+            }
+            // ONLY CONSTRAINTS THAT SHARE AT LEAST ONE TILE CAN TELL EACH OTHER ANYTHING
+            if (nOnlyThis == constraint.nTiles) continue;
+            for (int i = 0; i < other.nTiles; ++i)
+            {
+                if (!constraint.contains(other.tiles[i]))
+                {
+                    onlyOther[nOnlyOther++] = other.tiles[i];
+                }
+            }
+
+            if (other.nMines - constraint.nMines == nOnlyOther)
+            {
+                for (int i = 0; i < nOnlyOther; ++i)
+                {
+                    markTile(onlyOther[i], Knowledge::Mine);
+                }
+                for (int i = 0; i < nOnlyThis; ++i)
+                {
+                    markTile(onlyThis[i], Knowledge::Safe);
+                }
+            }
+            else if (constraint.nMines - other.nMines == nOnlyThis)
+            {
+                for (int i = 0; i < nOnlyThis; ++i)
+                {
+                    markTile(onlyThis[i], Knowledge::Mine);
+                }
+                for (int i = 0; i < nOnlyOther; ++i)
+                {
+                    markTile(onlyOther[i], Knowledge::Safe);
+                }
+            }
+        }
+    }
+}
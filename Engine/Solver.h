@@ -0,0 +1,60 @@
+#pragma once
+#include "Board.h"
+#include "Vei2.h"
+#include <vector>
+#include <algorithm>
+
+// DEDUCES CERTAIN MINES AND SAFE TILES FROM THE VISIBLE STATE OF A BOARD (REVEALED NUMBERS AND FLAGS).
+// FLAGS ARE TRUSTED AS MINES. KNOWLEDGE IS KEPT BETWEEN CALLS TO update(), WHICH ONLY RE-EXAMINES THE
+// NUMBERS AROUND TILES THAT CHANGED, SO A MOVE COSTS TIME PROPORTIONAL TO ITS EFFECT RATHER THAN THE BOARD SIZE
+class Solver
+{
+public:
+	enum class Knowledge : unsigned char
+	{
+		Unknown, Safe, Mine, Revealed
+	};
+public:
+	Solver(const Board& _board);
+	// ABSORBS THE TILES REVEALED OR FLAGGED SINCE THE LAST CALL AND PROPAGATES TO A FIXED POINT. IF ANY TILE WAS
+	// UNFLAGGED OR UN-REVEALED INSTEAD, ALL KNOWLEDGE IS DROPPED AND REBUILT FROM THE WHOLE VISIBLE STATE
+	void update();
+	Knowledge getKnowledge(const Vei2& gridPos) const;
+	// DEDUCED SAFE TILES THAT ARE STILL HIDDEN
+	const std::vector<Vei2>& getSafeTiles() const;
+	// DEDUCED MINES, FLAGGED OR NOT
+	const std::vector<Vei2>& getMines() const;
+private:
+	// HIDDEN NEIGHBORS OF A REVEALED NUMBER WHOSE STATE IS STILL UNKNOWN, AND HOW MANY OF THEM ARE MINES
+	struct Constraint
+	{
+		bool contains(int index) const
+		{
+			return std::find(tiles, tiles + nTiles, index) != tiles + nTiles;
+		}
+		int tiles[8];
+		int nTiles = 0;
+		int nMines = 0;
+	};
+private:
+	bool hasRemovedTiles(const BitPlane& boardPlane, const BitPlane& seenPlane) const;
+	void absorbChangedWords(const BitPlane& boardPlane, BitPlane& seenPlane, Knowledge knowledge);
+	void markTile(int index, Knowledge newKnowledge);
+	void queueNeighborConstraints(int index);
+	void queueConstraint(int index);
+	bool buildConstraint(int index, Constraint& constraint) const;
+	void applySinglePointRule(const Constraint& constraint);
+	void applySubsetRule(int index, const Constraint& constraint);
+private:
+	const Board& board;
+	int width;
+	int height;
+	std::vector<Knowledge> knowledge;
+	// COPIES OF THE BOARD'S REVEALED AND FLAGGED PLANES AS OF THE LAST update(), USED TO FIND WHAT CHANGED
+	BitPlane seenRevealed;
+	BitPlane seenFlagged;
+	std::vector<int> pendingConstraints;
+	std::vector<unsigned char> isConstraintPending;
+	std::vector<Vei2> safeTiles;
+	std::vector<Vei2> mines;
+};
@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+
+// SMALL COUNTER-BASED GENERATOR (STEELE, LEA AND FLOOD'S SPLITMIX64). THE OUTPUT ONLY DEPENDS ON THE SEED AND
+// THE NUMBER OF DRAWS, USING PLAIN 64-BIT ARITHMETIC, SO A SEED PRODUCES THE SAME SEQUENCE ON EVERY PLATFORM
+class SplitMix64
+{
+public:
+	explicit SplitMix64(uint64_t seed)
+		:state(seed)
+	{
+	}
+	// THE STATE ONLY ADVANCES BY A CONSTANT, SO THE index-TH OUTPUT OF A STREAM IS REACHED WITHOUT DRAWING THE
+	// ONES BEFORE IT. USED TO GIVE NUMBERED BOARDS OR GAMES THEIR OWN SEEDS
+	static uint64_t at(uint64_t seed, uint64_t index)
+	{
+		return SplitMix64(seed + index * GAMMA).next();
+	}
+	uint64_t next()
+	{
+		uint64_t z = (state += GAMMA);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9u;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBu;
+		return z ^ (z >> 31);
+	}
+	// UNIFORM INTEGER IN [0, bound) WITHOUT MODULO BIAS (LEMIRE'S MULTIPLY-AND-REJECT)
+	uint32_t nextBelow(uint32_t bound)
+	{
+		uint64_t product = (next() >> 32) * bound;
+		uint32_t low = uint32_t(product);
+		if (low < bound)
+		{
+			const uint32_t threshold = uint32_t(0u - bound) % bound;
+			while (low < threshold)
+			{
+				product = (next() >> 32) * bound;
+				low = uint32_t(product);
+			}
+		}
+		return uint32_t(product >> 32);
+	}
+private:
+	static constexpr uint64_t GAMMA = 0x9E3779B97F4A7C15u;
+private:
+	uint64_t state;
+};
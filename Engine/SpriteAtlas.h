@@ -0,0 +1,33 @@
+#pragma once
+#include "Colors.h"
+
+// EVERY SPRITE OF THE GAME PACKED INTO ONE IMAGE OF width x height PIXELS, STORED ROW BY ROW. PIXELS A SPRITE
+// DOES NOT DRAW HOLD chroma AND LEAVE WHAT IS BEHIND THEM, SO THE TILES STILL ASSUME A baseColor BACKGROUND
+namespace SpriteAtlas
+{
+	struct Sprite
+	{
+		int left;
+		int top;
+		int width;
+		int height;
+	};
+
+	constexpr int width = 248;
+	constexpr int height = 199;
+	constexpr Color chroma = { 255,0,255 };
+	extern const Color pixels[width * height];
+
+	constexpr Sprite win = { 0,0,248,183 };
+	// THE TILES LIE SIDE BY SIDE BELOW THE WIN SCREEN, THE NUMBERS 0 - 8 FIRST
+	constexpr Sprite tileNumbers[9] =
+	{
+		{ 0,183,16,16 },{ 16,183,16,16 },{ 32,183,16,16 },{ 48,183,16,16 },{ 64,183,16,16 },
+		{ 80,183,16,16 },{ 96,183,16,16 },{ 112,183,16,16 },{ 128,183,16,16 }
+	};
+	constexpr Sprite tileButton = { 144,183,16,16 };
+	constexpr Sprite tileCross = { 160,183,16,16 };
+	constexpr Sprite tileFlag = { 176,183,16,16 };
+	constexpr Sprite tileBomb = { 192,183,16,16 };
+	constexpr Sprite tileBombRed = { 208,183,16,16 };
+}
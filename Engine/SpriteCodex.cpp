@@ -1,1513 +1,122 @@
 #include "SpriteCodex.h"
+#include "SpriteAtlas.h"
+#include "RleSprite.h"
 #include <assert.h>
 
+namespace
+{
+	// the atlas sprites as spans, encoded on first use
+	struct SpanAtlas
+	{
+		SpanAtlas()
+			:
+			tileButton( Encode( SpriteAtlas::tileButton ) ),
+			tileCross( Encode( SpriteAtlas::tileCross ) ),
+			tileFlag( Encode( SpriteAtlas::tileFlag ) ),
+			tileBomb( Encode( SpriteAtlas::tileBomb ) ),
+			tileBombRed( Encode( SpriteAtlas::tileBombRed ) ),
+			win( Encode( SpriteAtlas::win ) )
+		{
+			for( int number = 0; number < 9; ++number )
+			{
+				tileNumbers[number] = Encode( SpriteAtlas::tileNumbers[number] );
+			}
+		}
+		static RleSprite Encode( const SpriteAtlas::Sprite& sprite )
+		{
+			return RleSprite( SpriteAtlas::pixels + SpriteAtlas::width * sprite.top + sprite.left,
+				SpriteAtlas::width,sprite.width,sprite.height,SpriteAtlas::chroma );
+		}
+		RleSprite tileNumbers[9];
+		RleSprite tileButton;
+		RleSprite tileCross;
+		RleSprite tileFlag;
+		RleSprite tileBomb;
+		RleSprite tileBombRed;
+		RleSprite win;
+	};
+
+	const SpanAtlas& GetSpanAtlas()
+	{
+		static const SpanAtlas atlas;
+		return atlas;
+	}
+}
+
 void SpriteCodex::DrawTile0( const Vei2& pos,Graphics& gfx )
 {
-	gfx.PutPixel( 0 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 2 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 13 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 14 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,1 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,2 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,13 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,15 + pos.y,128,128,128 );
+	gfx.DrawSprite( pos.x,pos.y,GetSpanAtlas().tileNumbers[0] );
 }
 
 void SpriteCodex::DrawTile1( const Vei2& pos,Graphics& gfx )
 {
-	gfx.PutPixel( 0 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 2 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 13 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 14 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,1 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,2 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,3 + pos.y,0,0,255 );
-	gfx.PutPixel( 9 + pos.x,3 + pos.y,0,0,255 );
-	gfx.PutPixel( 0 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,4 + pos.y,0,0,255 );
-	gfx.PutPixel( 8 + pos.x,4 + pos.y,0,0,255 );
-	gfx.PutPixel( 9 + pos.x,4 + pos.y,0,0,255 );
-	gfx.PutPixel( 0 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,5 + pos.y,0,0,255 );
-	gfx.PutPixel( 7 + pos.x,5 + pos.y,0,0,255 );
-	gfx.PutPixel( 8 + pos.x,5 + pos.y,0,0,255 );
-	gfx.PutPixel( 9 + pos.x,5 + pos.y,0,0,255 );
-	gfx.PutPixel( 0 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,6 + pos.y,0,0,255 );
-	gfx.PutPixel( 6 + pos.x,6 + pos.y,0,0,255 );
-	gfx.PutPixel( 7 + pos.x,6 + pos.y,0,0,255 );
-	gfx.PutPixel( 8 + pos.x,6 + pos.y,0,0,255 );
-	gfx.PutPixel( 9 + pos.x,6 + pos.y,0,0,255 );
-	gfx.PutPixel( 0 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,7 + pos.y,0,0,255 );
-	gfx.PutPixel( 8 + pos.x,7 + pos.y,0,0,255 );
-	gfx.PutPixel( 9 + pos.x,7 + pos.y,0,0,255 );
-	gfx.PutPixel( 0 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,8 + pos.y,0,0,255 );
-	gfx.PutPixel( 8 + pos.x,8 + pos.y,0,0,255 );
-	gfx.PutPixel( 9 + pos.x,8 + pos.y,0,0,255 );
-	gfx.PutPixel( 0 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,9 + pos.y,0,0,255 );
-	gfx.PutPixel( 8 + pos.x,9 + pos.y,0,0,255 );
-	gfx.PutPixel( 9 + pos.x,9 + pos.y,0,0,255 );
-	gfx.PutPixel( 0 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,10 + pos.y,0,0,255 );
-	gfx.PutPixel( 8 + pos.x,10 + pos.y,0,0,255 );
-	gfx.PutPixel( 9 + pos.x,10 + pos.y,0,0,255 );
-	gfx.PutPixel( 0 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,11 + pos.y,0,0,255 );
-	gfx.PutPixel( 6 + pos.x,11 + pos.y,0,0,255 );
-	gfx.PutPixel( 7 + pos.x,11 + pos.y,0,0,255 );
-	gfx.PutPixel( 8 + pos.x,11 + pos.y,0,0,255 );
-	gfx.PutPixel( 9 + pos.x,11 + pos.y,0,0,255 );
-	gfx.PutPixel( 10 + pos.x,11 + pos.y,0,0,255 );
-	gfx.PutPixel( 11 + pos.x,11 + pos.y,0,0,255 );
-	gfx.PutPixel( 0 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,12 + pos.y,0,0,255 );
-	gfx.PutPixel( 6 + pos.x,12 + pos.y,0,0,255 );
-	gfx.PutPixel( 7 + pos.x,12 + pos.y,0,0,255 );
-	gfx.PutPixel( 8 + pos.x,12 + pos.y,0,0,255 );
-	gfx.PutPixel( 9 + pos.x,12 + pos.y,0,0,255 );
-	gfx.PutPixel( 10 + pos.x,12 + pos.y,0,0,255 );
-	gfx.PutPixel( 11 + pos.x,12 + pos.y,0,0,255 );
-	gfx.PutPixel( 0 + pos.x,13 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,15 + pos.y,128,128,128 );
+	gfx.DrawSprite( pos.x,pos.y,GetSpanAtlas().tileNumbers[1] );
 }
 
 void SpriteCodex::DrawTile2( const Vei2& pos,Graphics& gfx )
 {
-	gfx.PutPixel( 0 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 2 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 13 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 14 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,1 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,2 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,3 + pos.y,0,128,0 );
-	gfx.PutPixel( 5 + pos.x,3 + pos.y,0,128,0 );
-	gfx.PutPixel( 6 + pos.x,3 + pos.y,0,128,0 );
-	gfx.PutPixel( 7 + pos.x,3 + pos.y,0,128,0 );
-	gfx.PutPixel( 8 + pos.x,3 + pos.y,0,128,0 );
-	gfx.PutPixel( 9 + pos.x,3 + pos.y,0,128,0 );
-	gfx.PutPixel( 10 + pos.x,3 + pos.y,0,128,0 );
-	gfx.PutPixel( 11 + pos.x,3 + pos.y,0,128,0 );
-	gfx.PutPixel( 0 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,4 + pos.y,0,128,0 );
-	gfx.PutPixel( 4 + pos.x,4 + pos.y,0,128,0 );
-	gfx.PutPixel( 5 + pos.x,4 + pos.y,0,128,0 );
-	gfx.PutPixel( 6 + pos.x,4 + pos.y,0,128,0 );
-	gfx.PutPixel( 7 + pos.x,4 + pos.y,0,128,0 );
-	gfx.PutPixel( 8 + pos.x,4 + pos.y,0,128,0 );
-	gfx.PutPixel( 9 + pos.x,4 + pos.y,0,128,0 );
-	gfx.PutPixel( 10 + pos.x,4 + pos.y,0,128,0 );
-	gfx.PutPixel( 11 + pos.x,4 + pos.y,0,128,0 );
-	gfx.PutPixel( 12 + pos.x,4 + pos.y,0,128,0 );
-	gfx.PutPixel( 0 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,5 + pos.y,0,128,0 );
-	gfx.PutPixel( 4 + pos.x,5 + pos.y,0,128,0 );
-	gfx.PutPixel( 5 + pos.x,5 + pos.y,0,128,0 );
-	gfx.PutPixel( 10 + pos.x,5 + pos.y,0,128,0 );
-	gfx.PutPixel( 11 + pos.x,5 + pos.y,0,128,0 );
-	gfx.PutPixel( 12 + pos.x,5 + pos.y,0,128,0 );
-	gfx.PutPixel( 0 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,6 + pos.y,0,128,0 );
-	gfx.PutPixel( 11 + pos.x,6 + pos.y,0,128,0 );
-	gfx.PutPixel( 12 + pos.x,6 + pos.y,0,128,0 );
-	gfx.PutPixel( 0 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,7 + pos.y,0,128,0 );
-	gfx.PutPixel( 9 + pos.x,7 + pos.y,0,128,0 );
-	gfx.PutPixel( 10 + pos.x,7 + pos.y,0,128,0 );
-	gfx.PutPixel( 11 + pos.x,7 + pos.y,0,128,0 );
-	gfx.PutPixel( 0 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,8 + pos.y,0,128,0 );
-	gfx.PutPixel( 7 + pos.x,8 + pos.y,0,128,0 );
-	gfx.PutPixel( 8 + pos.x,8 + pos.y,0,128,0 );
-	gfx.PutPixel( 9 + pos.x,8 + pos.y,0,128,0 );
-	gfx.PutPixel( 10 + pos.x,8 + pos.y,0,128,0 );
-	gfx.PutPixel( 0 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,9 + pos.y,0,128,0 );
-	gfx.PutPixel( 5 + pos.x,9 + pos.y,0,128,0 );
-	gfx.PutPixel( 6 + pos.x,9 + pos.y,0,128,0 );
-	gfx.PutPixel( 7 + pos.x,9 + pos.y,0,128,0 );
-	gfx.PutPixel( 8 + pos.x,9 + pos.y,0,128,0 );
-	gfx.PutPixel( 0 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,10 + pos.y,0,128,0 );
-	gfx.PutPixel( 4 + pos.x,10 + pos.y,0,128,0 );
-	gfx.PutPixel( 5 + pos.x,10 + pos.y,0,128,0 );
-	gfx.PutPixel( 6 + pos.x,10 + pos.y,0,128,0 );
-	gfx.PutPixel( 0 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,11 + pos.y,0,128,0 );
-	gfx.PutPixel( 4 + pos.x,11 + pos.y,0,128,0 );
-	gfx.PutPixel( 5 + pos.x,11 + pos.y,0,128,0 );
-	gfx.PutPixel( 6 + pos.x,11 + pos.y,0,128,0 );
-	gfx.PutPixel( 7 + pos.x,11 + pos.y,0,128,0 );
-	gfx.PutPixel( 8 + pos.x,11 + pos.y,0,128,0 );
-	gfx.PutPixel( 9 + pos.x,11 + pos.y,0,128,0 );
-	gfx.PutPixel( 10 + pos.x,11 + pos.y,0,128,0 );
-	gfx.PutPixel( 11 + pos.x,11 + pos.y,0,128,0 );
-	gfx.PutPixel( 12 + pos.x,11 + pos.y,0,128,0 );
-	gfx.PutPixel( 0 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,12 + pos.y,0,128,0 );
-	gfx.PutPixel( 4 + pos.x,12 + pos.y,0,128,0 );
-	gfx.PutPixel( 5 + pos.x,12 + pos.y,0,128,0 );
-	gfx.PutPixel( 6 + pos.x,12 + pos.y,0,128,0 );
-	gfx.PutPixel( 7 + pos.x,12 + pos.y,0,128,0 );
-	gfx.PutPixel( 8 + pos.x,12 + pos.y,0,128,0 );
-	gfx.PutPixel( 9 + pos.x,12 + pos.y,0,128,0 );
-	gfx.PutPixel( 10 + pos.x,12 + pos.y,0,128,0 );
-	gfx.PutPixel( 11 + pos.x,12 + pos.y,0,128,0 );
-	gfx.PutPixel( 12 + pos.x,12 + pos.y,0,128,0 );
-	gfx.PutPixel( 0 + pos.x,13 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,15 + pos.y,128,128,128 );
+	gfx.DrawSprite( pos.x,pos.y,GetSpanAtlas().tileNumbers[2] );
 }
 
 void SpriteCodex::DrawTile3( const Vei2& pos,Graphics& gfx )
 {
-	gfx.PutPixel( 0 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 2 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 13 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 14 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,1 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,2 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 4 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 5 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 6 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 7 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 8 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 9 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 10 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 11 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 4 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 5 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 6 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 7 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 8 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 9 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 10 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 11 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 12 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,5 + pos.y,255,0,0 );
-	gfx.PutPixel( 11 + pos.x,5 + pos.y,255,0,0 );
-	gfx.PutPixel( 12 + pos.x,5 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,6 + pos.y,255,0,0 );
-	gfx.PutPixel( 11 + pos.x,6 + pos.y,255,0,0 );
-	gfx.PutPixel( 12 + pos.x,6 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,7 + pos.y,255,0,0 );
-	gfx.PutPixel( 7 + pos.x,7 + pos.y,255,0,0 );
-	gfx.PutPixel( 8 + pos.x,7 + pos.y,255,0,0 );
-	gfx.PutPixel( 9 + pos.x,7 + pos.y,255,0,0 );
-	gfx.PutPixel( 10 + pos.x,7 + pos.y,255,0,0 );
-	gfx.PutPixel( 11 + pos.x,7 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,8 + pos.y,255,0,0 );
-	gfx.PutPixel( 7 + pos.x,8 + pos.y,255,0,0 );
-	gfx.PutPixel( 8 + pos.x,8 + pos.y,255,0,0 );
-	gfx.PutPixel( 9 + pos.x,8 + pos.y,255,0,0 );
-	gfx.PutPixel( 10 + pos.x,8 + pos.y,255,0,0 );
-	gfx.PutPixel( 11 + pos.x,8 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,9 + pos.y,255,0,0 );
-	gfx.PutPixel( 11 + pos.x,9 + pos.y,255,0,0 );
-	gfx.PutPixel( 12 + pos.x,9 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,10 + pos.y,255,0,0 );
-	gfx.PutPixel( 11 + pos.x,10 + pos.y,255,0,0 );
-	gfx.PutPixel( 12 + pos.x,10 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 4 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 5 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 6 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 7 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 8 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 9 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 10 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 11 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 12 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 4 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 5 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 6 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 7 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 8 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 9 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 10 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 11 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,13 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,15 + pos.y,128,128,128 );
+	gfx.DrawSprite( pos.x,pos.y,GetSpanAtlas().tileNumbers[3] );
 }
 
 void SpriteCodex::DrawTile4( const Vei2& pos,Graphics& gfx )
 {
-	gfx.PutPixel( 0 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 2 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 13 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 14 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,1 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,2 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,3 + pos.y,0,0,128 );
-	gfx.PutPixel( 6 + pos.x,3 + pos.y,0,0,128 );
-	gfx.PutPixel( 7 + pos.x,3 + pos.y,0,0,128 );
-	gfx.PutPixel( 9 + pos.x,3 + pos.y,0,0,128 );
-	gfx.PutPixel( 10 + pos.x,3 + pos.y,0,0,128 );
-	gfx.PutPixel( 11 + pos.x,3 + pos.y,0,0,128 );
-	gfx.PutPixel( 0 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,4 + pos.y,0,0,128 );
-	gfx.PutPixel( 6 + pos.x,4 + pos.y,0,0,128 );
-	gfx.PutPixel( 7 + pos.x,4 + pos.y,0,0,128 );
-	gfx.PutPixel( 9 + pos.x,4 + pos.y,0,0,128 );
-	gfx.PutPixel( 10 + pos.x,4 + pos.y,0,0,128 );
-	gfx.PutPixel( 11 + pos.x,4 + pos.y,0,0,128 );
-	gfx.PutPixel( 0 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,5 + pos.y,0,0,128 );
-	gfx.PutPixel( 5 + pos.x,5 + pos.y,0,0,128 );
-	gfx.PutPixel( 6 + pos.x,5 + pos.y,0,0,128 );
-	gfx.PutPixel( 9 + pos.x,5 + pos.y,0,0,128 );
-	gfx.PutPixel( 10 + pos.x,5 + pos.y,0,0,128 );
-	gfx.PutPixel( 11 + pos.x,5 + pos.y,0,0,128 );
-	gfx.PutPixel( 0 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,6 + pos.y,0,0,128 );
-	gfx.PutPixel( 5 + pos.x,6 + pos.y,0,0,128 );
-	gfx.PutPixel( 6 + pos.x,6 + pos.y,0,0,128 );
-	gfx.PutPixel( 9 + pos.x,6 + pos.y,0,0,128 );
-	gfx.PutPixel( 10 + pos.x,6 + pos.y,0,0,128 );
-	gfx.PutPixel( 11 + pos.x,6 + pos.y,0,0,128 );
-	gfx.PutPixel( 0 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,7 + pos.y,0,0,128 );
-	gfx.PutPixel( 4 + pos.x,7 + pos.y,0,0,128 );
-	gfx.PutPixel( 5 + pos.x,7 + pos.y,0,0,128 );
-	gfx.PutPixel( 6 + pos.x,7 + pos.y,0,0,128 );
-	gfx.PutPixel( 7 + pos.x,7 + pos.y,0,0,128 );
-	gfx.PutPixel( 8 + pos.x,7 + pos.y,0,0,128 );
-	gfx.PutPixel( 9 + pos.x,7 + pos.y,0,0,128 );
-	gfx.PutPixel( 10 + pos.x,7 + pos.y,0,0,128 );
-	gfx.PutPixel( 11 + pos.x,7 + pos.y,0,0,128 );
-	gfx.PutPixel( 12 + pos.x,7 + pos.y,0,0,128 );
-	gfx.PutPixel( 0 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,8 + pos.y,0,0,128 );
-	gfx.PutPixel( 4 + pos.x,8 + pos.y,0,0,128 );
-	gfx.PutPixel( 5 + pos.x,8 + pos.y,0,0,128 );
-	gfx.PutPixel( 6 + pos.x,8 + pos.y,0,0,128 );
-	gfx.PutPixel( 7 + pos.x,8 + pos.y,0,0,128 );
-	gfx.PutPixel( 8 + pos.x,8 + pos.y,0,0,128 );
-	gfx.PutPixel( 9 + pos.x,8 + pos.y,0,0,128 );
-	gfx.PutPixel( 10 + pos.x,8 + pos.y,0,0,128 );
-	gfx.PutPixel( 11 + pos.x,8 + pos.y,0,0,128 );
-	gfx.PutPixel( 12 + pos.x,8 + pos.y,0,0,128 );
-	gfx.PutPixel( 0 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,9 + pos.y,0,0,128 );
-	gfx.PutPixel( 10 + pos.x,9 + pos.y,0,0,128 );
-	gfx.PutPixel( 11 + pos.x,9 + pos.y,0,0,128 );
-	gfx.PutPixel( 0 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,10 + pos.y,0,0,128 );
-	gfx.PutPixel( 10 + pos.x,10 + pos.y,0,0,128 );
-	gfx.PutPixel( 11 + pos.x,10 + pos.y,0,0,128 );
-	gfx.PutPixel( 0 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,11 + pos.y,0,0,128 );
-	gfx.PutPixel( 10 + pos.x,11 + pos.y,0,0,128 );
-	gfx.PutPixel( 11 + pos.x,11 + pos.y,0,0,128 );
-	gfx.PutPixel( 0 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,12 + pos.y,0,0,128 );
-	gfx.PutPixel( 10 + pos.x,12 + pos.y,0,0,128 );
-	gfx.PutPixel( 11 + pos.x,12 + pos.y,0,0,128 );
-	gfx.PutPixel( 0 + pos.x,13 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,15 + pos.y,128,128,128 );
+	gfx.DrawSprite( pos.x,pos.y,GetSpanAtlas().tileNumbers[4] );
 }
 
 void SpriteCodex::DrawTile5( const Vei2& pos,Graphics& gfx )
 {
-	gfx.PutPixel( 0 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 2 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 13 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 14 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,1 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,2 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,3 + pos.y,128,0,0 );
-	gfx.PutPixel( 4 + pos.x,3 + pos.y,128,0,0 );
-	gfx.PutPixel( 5 + pos.x,3 + pos.y,128,0,0 );
-	gfx.PutPixel( 6 + pos.x,3 + pos.y,128,0,0 );
-	gfx.PutPixel( 7 + pos.x,3 + pos.y,128,0,0 );
-	gfx.PutPixel( 8 + pos.x,3 + pos.y,128,0,0 );
-	gfx.PutPixel( 9 + pos.x,3 + pos.y,128,0,0 );
-	gfx.PutPixel( 10 + pos.x,3 + pos.y,128,0,0 );
-	gfx.PutPixel( 11 + pos.x,3 + pos.y,128,0,0 );
-	gfx.PutPixel( 12 + pos.x,3 + pos.y,128,0,0 );
-	gfx.PutPixel( 0 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,4 + pos.y,128,0,0 );
-	gfx.PutPixel( 4 + pos.x,4 + pos.y,128,0,0 );
-	gfx.PutPixel( 5 + pos.x,4 + pos.y,128,0,0 );
-	gfx.PutPixel( 6 + pos.x,4 + pos.y,128,0,0 );
-	gfx.PutPixel( 7 + pos.x,4 + pos.y,128,0,0 );
-	gfx.PutPixel( 8 + pos.x,4 + pos.y,128,0,0 );
-	gfx.PutPixel( 9 + pos.x,4 + pos.y,128,0,0 );
-	gfx.PutPixel( 10 + pos.x,4 + pos.y,128,0,0 );
-	gfx.PutPixel( 11 + pos.x,4 + pos.y,128,0,0 );
-	gfx.PutPixel( 12 + pos.x,4 + pos.y,128,0,0 );
-	gfx.PutPixel( 0 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,5 + pos.y,128,0,0 );
-	gfx.PutPixel( 4 + pos.x,5 + pos.y,128,0,0 );
-	gfx.PutPixel( 5 + pos.x,5 + pos.y,128,0,0 );
-	gfx.PutPixel( 0 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,6 + pos.y,128,0,0 );
-	gfx.PutPixel( 4 + pos.x,6 + pos.y,128,0,0 );
-	gfx.PutPixel( 5 + pos.x,6 + pos.y,128,0,0 );
-	gfx.PutPixel( 0 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,7 + pos.y,128,0,0 );
-	gfx.PutPixel( 4 + pos.x,7 + pos.y,128,0,0 );
-	gfx.PutPixel( 5 + pos.x,7 + pos.y,128,0,0 );
-	gfx.PutPixel( 6 + pos.x,7 + pos.y,128,0,0 );
-	gfx.PutPixel( 7 + pos.x,7 + pos.y,128,0,0 );
-	gfx.PutPixel( 8 + pos.x,7 + pos.y,128,0,0 );
-	gfx.PutPixel( 9 + pos.x,7 + pos.y,128,0,0 );
-	gfx.PutPixel( 10 + pos.x,7 + pos.y,128,0,0 );
-	gfx.PutPixel( 11 + pos.x,7 + pos.y,128,0,0 );
-	gfx.PutPixel( 0 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,8 + pos.y,128,0,0 );
-	gfx.PutPixel( 4 + pos.x,8 + pos.y,128,0,0 );
-	gfx.PutPixel( 5 + pos.x,8 + pos.y,128,0,0 );
-	gfx.PutPixel( 6 + pos.x,8 + pos.y,128,0,0 );
-	gfx.PutPixel( 7 + pos.x,8 + pos.y,128,0,0 );
-	gfx.PutPixel( 8 + pos.x,8 + pos.y,128,0,0 );
-	gfx.PutPixel( 9 + pos.x,8 + pos.y,128,0,0 );
-	gfx.PutPixel( 10 + pos.x,8 + pos.y,128,0,0 );
-	gfx.PutPixel( 11 + pos.x,8 + pos.y,128,0,0 );
-	gfx.PutPixel( 12 + pos.x,8 + pos.y,128,0,0 );
-	gfx.PutPixel( 0 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,9 + pos.y,128,0,0 );
-	gfx.PutPixel( 11 + pos.x,9 + pos.y,128,0,0 );
-	gfx.PutPixel( 12 + pos.x,9 + pos.y,128,0,0 );
-	gfx.PutPixel( 0 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,10 + pos.y,128,0,0 );
-	gfx.PutPixel( 11 + pos.x,10 + pos.y,128,0,0 );
-	gfx.PutPixel( 12 + pos.x,10 + pos.y,128,0,0 );
-	gfx.PutPixel( 0 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,11 + pos.y,128,0,0 );
-	gfx.PutPixel( 4 + pos.x,11 + pos.y,128,0,0 );
-	gfx.PutPixel( 5 + pos.x,11 + pos.y,128,0,0 );
-	gfx.PutPixel( 6 + pos.x,11 + pos.y,128,0,0 );
-	gfx.PutPixel( 7 + pos.x,11 + pos.y,128,0,0 );
-	gfx.PutPixel( 8 + pos.x,11 + pos.y,128,0,0 );
-	gfx.PutPixel( 9 + pos.x,11 + pos.y,128,0,0 );
-	gfx.PutPixel( 10 + pos.x,11 + pos.y,128,0,0 );
-	gfx.PutPixel( 11 + pos.x,11 + pos.y,128,0,0 );
-	gfx.PutPixel( 12 + pos.x,11 + pos.y,128,0,0 );
-	gfx.PutPixel( 0 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,12 + pos.y,128,0,0 );
-	gfx.PutPixel( 4 + pos.x,12 + pos.y,128,0,0 );
-	gfx.PutPixel( 5 + pos.x,12 + pos.y,128,0,0 );
-	gfx.PutPixel( 6 + pos.x,12 + pos.y,128,0,0 );
-	gfx.PutPixel( 7 + pos.x,12 + pos.y,128,0,0 );
-	gfx.PutPixel( 8 + pos.x,12 + pos.y,128,0,0 );
-	gfx.PutPixel( 9 + pos.x,12 + pos.y,128,0,0 );
-	gfx.PutPixel( 10 + pos.x,12 + pos.y,128,0,0 );
-	gfx.PutPixel( 11 + pos.x,12 + pos.y,128,0,0 );
-	gfx.PutPixel( 0 + pos.x,13 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,15 + pos.y,128,128,128 );
+	gfx.DrawSprite( pos.x,pos.y,GetSpanAtlas().tileNumbers[5] );
 }
 
 void SpriteCodex::DrawTile6( const Vei2& pos,Graphics& gfx )
 {
-	gfx.PutPixel( 0 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 2 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 13 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 14 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,1 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,2 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,3 + pos.y,0,128,128 );
-	gfx.PutPixel( 5 + pos.x,3 + pos.y,0,128,128 );
-	gfx.PutPixel( 6 + pos.x,3 + pos.y,0,128,128 );
-	gfx.PutPixel( 7 + pos.x,3 + pos.y,0,128,128 );
-	gfx.PutPixel( 8 + pos.x,3 + pos.y,0,128,128 );
-	gfx.PutPixel( 9 + pos.x,3 + pos.y,0,128,128 );
-	gfx.PutPixel( 10 + pos.x,3 + pos.y,0,128,128 );
-	gfx.PutPixel( 11 + pos.x,3 + pos.y,0,128,128 );
-	gfx.PutPixel( 0 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,4 + pos.y,0,128,128 );
-	gfx.PutPixel( 4 + pos.x,4 + pos.y,0,128,128 );
-	gfx.PutPixel( 5 + pos.x,4 + pos.y,0,128,128 );
-	gfx.PutPixel( 6 + pos.x,4 + pos.y,0,128,128 );
-	gfx.PutPixel( 7 + pos.x,4 + pos.y,0,128,128 );
-	gfx.PutPixel( 8 + pos.x,4 + pos.y,0,128,128 );
-	gfx.PutPixel( 9 + pos.x,4 + pos.y,0,128,128 );
-	gfx.PutPixel( 10 + pos.x,4 + pos.y,0,128,128 );
-	gfx.PutPixel( 11 + pos.x,4 + pos.y,0,128,128 );
-	gfx.PutPixel( 0 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,5 + pos.y,0,128,128 );
-	gfx.PutPixel( 4 + pos.x,5 + pos.y,0,128,128 );
-	gfx.PutPixel( 5 + pos.x,5 + pos.y,0,128,128 );
-	gfx.PutPixel( 0 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,6 + pos.y,0,128,128 );
-	gfx.PutPixel( 4 + pos.x,6 + pos.y,0,128,128 );
-	gfx.PutPixel( 5 + pos.x,6 + pos.y,0,128,128 );
-	gfx.PutPixel( 0 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,7 + pos.y,0,128,128 );
-	gfx.PutPixel( 4 + pos.x,7 + pos.y,0,128,128 );
-	gfx.PutPixel( 5 + pos.x,7 + pos.y,0,128,128 );
-	gfx.PutPixel( 6 + pos.x,7 + pos.y,0,128,128 );
-	gfx.PutPixel( 7 + pos.x,7 + pos.y,0,128,128 );
-	gfx.PutPixel( 8 + pos.x,7 + pos.y,0,128,128 );
-	gfx.PutPixel( 9 + pos.x,7 + pos.y,0,128,128 );
-	gfx.PutPixel( 10 + pos.x,7 + pos.y,0,128,128 );
-	gfx.PutPixel( 11 + pos.x,7 + pos.y,0,128,128 );
-	gfx.PutPixel( 0 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,8 + pos.y,0,128,128 );
-	gfx.PutPixel( 4 + pos.x,8 + pos.y,0,128,128 );
-	gfx.PutPixel( 5 + pos.x,8 + pos.y,0,128,128 );
-	gfx.PutPixel( 6 + pos.x,8 + pos.y,0,128,128 );
-	gfx.PutPixel( 7 + pos.x,8 + pos.y,0,128,128 );
-	gfx.PutPixel( 8 + pos.x,8 + pos.y,0,128,128 );
-	gfx.PutPixel( 9 + pos.x,8 + pos.y,0,128,128 );
-	gfx.PutPixel( 10 + pos.x,8 + pos.y,0,128,128 );
-	gfx.PutPixel( 11 + pos.x,8 + pos.y,0,128,128 );
-	gfx.PutPixel( 12 + pos.x,8 + pos.y,0,128,128 );
-	gfx.PutPixel( 0 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,9 + pos.y,0,128,128 );
-	gfx.PutPixel( 4 + pos.x,9 + pos.y,0,128,128 );
-	gfx.PutPixel( 5 + pos.x,9 + pos.y,0,128,128 );
-	gfx.PutPixel( 10 + pos.x,9 + pos.y,0,128,128 );
-	gfx.PutPixel( 11 + pos.x,9 + pos.y,0,128,128 );
-	gfx.PutPixel( 12 + pos.x,9 + pos.y,0,128,128 );
-	gfx.PutPixel( 0 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,10 + pos.y,0,128,128 );
-	gfx.PutPixel( 4 + pos.x,10 + pos.y,0,128,128 );
-	gfx.PutPixel( 5 + pos.x,10 + pos.y,0,128,128 );
-	gfx.PutPixel( 10 + pos.x,10 + pos.y,0,128,128 );
-	gfx.PutPixel( 11 + pos.x,10 + pos.y,0,128,128 );
-	gfx.PutPixel( 12 + pos.x,10 + pos.y,0,128,128 );
-	gfx.PutPixel( 0 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,11 + pos.y,0,128,128 );
-	gfx.PutPixel( 4 + pos.x,11 + pos.y,0,128,128 );
-	gfx.PutPixel( 5 + pos.x,11 + pos.y,0,128,128 );
-	gfx.PutPixel( 6 + pos.x,11 + pos.y,0,128,128 );
-	gfx.PutPixel( 7 + pos.x,11 + pos.y,0,128,128 );
-	gfx.PutPixel( 8 + pos.x,11 + pos.y,0,128,128 );
-	gfx.PutPixel( 9 + pos.x,11 + pos.y,0,128,128 );
-	gfx.PutPixel( 10 + pos.x,11 + pos.y,0,128,128 );
-	gfx.PutPixel( 11 + pos.x,11 + pos.y,0,128,128 );
-	gfx.PutPixel( 12 + pos.x,11 + pos.y,0,128,128 );
-	gfx.PutPixel( 0 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,12 + pos.y,0,128,128 );
-	gfx.PutPixel( 5 + pos.x,12 + pos.y,0,128,128 );
-	gfx.PutPixel( 6 + pos.x,12 + pos.y,0,128,128 );
-	gfx.PutPixel( 7 + pos.x,12 + pos.y,0,128,128 );
-	gfx.PutPixel( 8 + pos.x,12 + pos.y,0,128,128 );
-	gfx.PutPixel( 9 + pos.x,12 + pos.y,0,128,128 );
-	gfx.PutPixel( 10 + pos.x,12 + pos.y,0,128,128 );
-	gfx.PutPixel( 11 + pos.x,12 + pos.y,0,128,128 );
-	gfx.PutPixel( 0 + pos.x,13 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,15 + pos.y,128,128,128 );
+	gfx.DrawSprite( pos.x,pos.y,GetSpanAtlas().tileNumbers[6] );
 }
 
 void SpriteCodex::DrawTile7( const Vei2& pos,Graphics& gfx )
 {
-	gfx.PutPixel( 0 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 2 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 13 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 14 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,1 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,2 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,3 + pos.y,0,0,0 );
-	gfx.PutPixel( 4 + pos.x,3 + pos.y,0,0,0 );
-	gfx.PutPixel( 5 + pos.x,3 + pos.y,0,0,0 );
-	gfx.PutPixel( 6 + pos.x,3 + pos.y,0,0,0 );
-	gfx.PutPixel( 7 + pos.x,3 + pos.y,0,0,0 );
-	gfx.PutPixel( 8 + pos.x,3 + pos.y,0,0,0 );
-	gfx.PutPixel( 9 + pos.x,3 + pos.y,0,0,0 );
-	gfx.PutPixel( 10 + pos.x,3 + pos.y,0,0,0 );
-	gfx.PutPixel( 11 + pos.x,3 + pos.y,0,0,0 );
-	gfx.PutPixel( 12 + pos.x,3 + pos.y,0,0,0 );
-	gfx.PutPixel( 0 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,4 + pos.y,0,0,0 );
-	gfx.PutPixel( 4 + pos.x,4 + pos.y,0,0,0 );
-	gfx.PutPixel( 5 + pos.x,4 + pos.y,0,0,0 );
-	gfx.PutPixel( 6 + pos.x,4 + pos.y,0,0,0 );
-	gfx.PutPixel( 7 + pos.x,4 + pos.y,0,0,0 );
-	gfx.PutPixel( 8 + pos.x,4 + pos.y,0,0,0 );
-	gfx.PutPixel( 9 + pos.x,4 + pos.y,0,0,0 );
-	gfx.PutPixel( 10 + pos.x,4 + pos.y,0,0,0 );
-	gfx.PutPixel( 11 + pos.x,4 + pos.y,0,0,0 );
-	gfx.PutPixel( 12 + pos.x,4 + pos.y,0,0,0 );
-	gfx.PutPixel( 0 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,5 + pos.y,0,0,0 );
-	gfx.PutPixel( 11 + pos.x,5 + pos.y,0,0,0 );
-	gfx.PutPixel( 12 + pos.x,5 + pos.y,0,0,0 );
-	gfx.PutPixel( 0 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,6 + pos.y,0,0,0 );
-	gfx.PutPixel( 11 + pos.x,6 + pos.y,0,0,0 );
-	gfx.PutPixel( 12 + pos.x,6 + pos.y,0,0,0 );
-	gfx.PutPixel( 0 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,7 + pos.y,0,0,0 );
-	gfx.PutPixel( 10 + pos.x,7 + pos.y,0,0,0 );
-	gfx.PutPixel( 11 + pos.x,7 + pos.y,0,0,0 );
-	gfx.PutPixel( 0 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,8 + pos.y,0,0,0 );
-	gfx.PutPixel( 10 + pos.x,8 + pos.y,0,0,0 );
-	gfx.PutPixel( 11 + pos.x,8 + pos.y,0,0,0 );
-	gfx.PutPixel( 0 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,9 + pos.y,0,0,0 );
-	gfx.PutPixel( 9 + pos.x,9 + pos.y,0,0,0 );
-	gfx.PutPixel( 10 + pos.x,9 + pos.y,0,0,0 );
-	gfx.PutPixel( 0 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,10 + pos.y,0,0,0 );
-	gfx.PutPixel( 9 + pos.x,10 + pos.y,0,0,0 );
-	gfx.PutPixel( 10 + pos.x,10 + pos.y,0,0,0 );
-	gfx.PutPixel( 0 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,11 + pos.y,0,0,0 );
-	gfx.PutPixel( 8 + pos.x,11 + pos.y,0,0,0 );
-	gfx.PutPixel( 9 + pos.x,11 + pos.y,0,0,0 );
-	gfx.PutPixel( 0 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,12 + pos.y,0,0,0 );
-	gfx.PutPixel( 8 + pos.x,12 + pos.y,0,0,0 );
-	gfx.PutPixel( 9 + pos.x,12 + pos.y,0,0,0 );
-	gfx.PutPixel( 0 + pos.x,13 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,15 + pos.y,128,128,128 );
+	gfx.DrawSprite( pos.x,pos.y,GetSpanAtlas().tileNumbers[7] );
 }
 
 void SpriteCodex::DrawTile8( const Vei2& pos,Graphics& gfx )
 {
-	gfx.PutPixel( 0 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 2 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 13 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 14 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,1 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,2 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,13 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,15 + pos.y,128,128,128 );
+	gfx.DrawSprite( pos.x,pos.y,GetSpanAtlas().tileNumbers[8] );
 }
 
 void SpriteCodex::DrawTileButton( const Vei2& pos,Graphics& gfx )
 {
-	gfx.PutPixel( 0 + pos.x,0 + pos.y,255,255,255 );
-	gfx.PutPixel( 1 + pos.x,0 + pos.y,255,255,255 );
-	gfx.PutPixel( 2 + pos.x,0 + pos.y,255,255,255 );
-	gfx.PutPixel( 3 + pos.x,0 + pos.y,255,255,255 );
-	gfx.PutPixel( 4 + pos.x,0 + pos.y,255,255,255 );
-	gfx.PutPixel( 5 + pos.x,0 + pos.y,255,255,255 );
-	gfx.PutPixel( 6 + pos.x,0 + pos.y,255,255,255 );
-	gfx.PutPixel( 7 + pos.x,0 + pos.y,255,255,255 );
-	gfx.PutPixel( 8 + pos.x,0 + pos.y,255,255,255 );
-	gfx.PutPixel( 9 + pos.x,0 + pos.y,255,255,255 );
-	gfx.PutPixel( 10 + pos.x,0 + pos.y,255,255,255 );
-	gfx.PutPixel( 11 + pos.x,0 + pos.y,255,255,255 );
-	gfx.PutPixel( 12 + pos.x,0 + pos.y,255,255,255 );
-	gfx.PutPixel( 13 + pos.x,0 + pos.y,255,255,255 );
-	gfx.PutPixel( 14 + pos.x,0 + pos.y,255,255,255 );
-	gfx.PutPixel( 0 + pos.x,1 + pos.y,255,255,255 );
-	gfx.PutPixel( 1 + pos.x,1 + pos.y,255,255,255 );
-	gfx.PutPixel( 2 + pos.x,1 + pos.y,255,255,255 );
-	gfx.PutPixel( 3 + pos.x,1 + pos.y,255,255,255 );
-	gfx.PutPixel( 4 + pos.x,1 + pos.y,255,255,255 );
-	gfx.PutPixel( 5 + pos.x,1 + pos.y,255,255,255 );
-	gfx.PutPixel( 6 + pos.x,1 + pos.y,255,255,255 );
-	gfx.PutPixel( 7 + pos.x,1 + pos.y,255,255,255 );
-	gfx.PutPixel( 8 + pos.x,1 + pos.y,255,255,255 );
-	gfx.PutPixel( 9 + pos.x,1 + pos.y,255,255,255 );
-	gfx.PutPixel( 10 + pos.x,1 + pos.y,255,255,255 );
-	gfx.PutPixel( 11 + pos.x,1 + pos.y,255,255,255 );
-	gfx.PutPixel( 12 + pos.x,1 + pos.y,255,255,255 );
-	gfx.PutPixel( 13 + pos.x,1 + pos.y,255,255,255 );
-	gfx.PutPixel( 15 + pos.x,1 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,2 + pos.y,255,255,255 );
-	gfx.PutPixel( 1 + pos.x,2 + pos.y,255,255,255 );
-	gfx.PutPixel( 14 + pos.x,2 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,2 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,3 + pos.y,255,255,255 );
-	gfx.PutPixel( 1 + pos.x,3 + pos.y,255,255,255 );
-	gfx.PutPixel( 14 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,4 + pos.y,255,255,255 );
-	gfx.PutPixel( 1 + pos.x,4 + pos.y,255,255,255 );
-	gfx.PutPixel( 14 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,5 + pos.y,255,255,255 );
-	gfx.PutPixel( 1 + pos.x,5 + pos.y,255,255,255 );
-	gfx.PutPixel( 14 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,6 + pos.y,255,255,255 );
-	gfx.PutPixel( 1 + pos.x,6 + pos.y,255,255,255 );
-	gfx.PutPixel( 14 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,7 + pos.y,255,255,255 );
-	gfx.PutPixel( 1 + pos.x,7 + pos.y,255,255,255 );
-	gfx.PutPixel( 14 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,8 + pos.y,255,255,255 );
-	gfx.PutPixel( 1 + pos.x,8 + pos.y,255,255,255 );
-	gfx.PutPixel( 14 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,9 + pos.y,255,255,255 );
-	gfx.PutPixel( 1 + pos.x,9 + pos.y,255,255,255 );
-	gfx.PutPixel( 14 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,10 + pos.y,255,255,255 );
-	gfx.PutPixel( 1 + pos.x,10 + pos.y,255,255,255 );
-	gfx.PutPixel( 14 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,11 + pos.y,255,255,255 );
-	gfx.PutPixel( 1 + pos.x,11 + pos.y,255,255,255 );
-	gfx.PutPixel( 14 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,12 + pos.y,255,255,255 );
-	gfx.PutPixel( 1 + pos.x,12 + pos.y,255,255,255 );
-	gfx.PutPixel( 14 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,13 + pos.y,255,255,255 );
-	gfx.PutPixel( 1 + pos.x,13 + pos.y,255,255,255 );
-	gfx.PutPixel( 14 + pos.x,13 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,13 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,14 + pos.y,255,255,255 );
-	gfx.PutPixel( 2 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 13 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 14 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,15 + pos.y,128,128,128 );
-	gfx.PutPixel( 2 + pos.x,15 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,15 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,15 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,15 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,15 + pos.y,128,128,128 );
-	gfx.PutPixel( 7 + pos.x,15 + pos.y,128,128,128 );
-	gfx.PutPixel( 8 + pos.x,15 + pos.y,128,128,128 );
-	gfx.PutPixel( 9 + pos.x,15 + pos.y,128,128,128 );
-	gfx.PutPixel( 10 + pos.x,15 + pos.y,128,128,128 );
-	gfx.PutPixel( 11 + pos.x,15 + pos.y,128,128,128 );
-	gfx.PutPixel( 12 + pos.x,15 + pos.y,128,128,128 );
-	gfx.PutPixel( 13 + pos.x,15 + pos.y,128,128,128 );
-	gfx.PutPixel( 14 + pos.x,15 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,15 + pos.y,128,128,128 );
+	gfx.DrawSprite( pos.x,pos.y,GetSpanAtlas().tileButton );
 }
 
 void SpriteCodex::DrawTileCross( const Vei2& pos,Graphics& gfx )
 {
-	gfx.PutPixel( 2 + pos.x,2 + pos.y,255,0,0 );
-	gfx.PutPixel( 3 + pos.x,2 + pos.y,255,0,0 );
-	gfx.PutPixel( 13 + pos.x,2 + pos.y,255,0,0 );
-	gfx.PutPixel( 14 + pos.x,2 + pos.y,255,0,0 );
-	gfx.PutPixel( 3 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 4 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 12 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 13 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 4 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 5 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 11 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 12 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 5 + pos.x,5 + pos.y,255,0,0 );
-	gfx.PutPixel( 6 + pos.x,5 + pos.y,255,0,0 );
-	gfx.PutPixel( 10 + pos.x,5 + pos.y,255,0,0 );
-	gfx.PutPixel( 11 + pos.x,5 + pos.y,255,0,0 );
-	gfx.PutPixel( 6 + pos.x,6 + pos.y,255,0,0 );
-	gfx.PutPixel( 7 + pos.x,6 + pos.y,255,0,0 );
-	gfx.PutPixel( 9 + pos.x,6 + pos.y,255,0,0 );
-	gfx.PutPixel( 10 + pos.x,6 + pos.y,255,0,0 );
-	gfx.PutPixel( 7 + pos.x,7 + pos.y,255,0,0 );
-	gfx.PutPixel( 8 + pos.x,7 + pos.y,255,0,0 );
-	gfx.PutPixel( 9 + pos.x,7 + pos.y,255,0,0 );
-	gfx.PutPixel( 7 + pos.x,8 + pos.y,255,0,0 );
-	gfx.PutPixel( 8 + pos.x,8 + pos.y,255,0,0 );
-	gfx.PutPixel( 9 + pos.x,8 + pos.y,255,0,0 );
-	gfx.PutPixel( 6 + pos.x,9 + pos.y,255,0,0 );
-	gfx.PutPixel( 7 + pos.x,9 + pos.y,255,0,0 );
-	gfx.PutPixel( 9 + pos.x,9 + pos.y,255,0,0 );
-	gfx.PutPixel( 10 + pos.x,9 + pos.y,255,0,0 );
-	gfx.PutPixel( 5 + pos.x,10 + pos.y,255,0,0 );
-	gfx.PutPixel( 6 + pos.x,10 + pos.y,255,0,0 );
-	gfx.PutPixel( 10 + pos.x,10 + pos.y,255,0,0 );
-	gfx.PutPixel( 11 + pos.x,10 + pos.y,255,0,0 );
-	gfx.PutPixel( 4 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 5 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 11 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 12 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 3 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 4 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 12 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 13 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 2 + pos.x,13 + pos.y,255,0,0 );
-	gfx.PutPixel( 3 + pos.x,13 + pos.y,255,0,0 );
-	gfx.PutPixel( 13 + pos.x,13 + pos.y,255,0,0 );
-	gfx.PutPixel( 14 + pos.x,13 + pos.y,255,0,0 );
+	gfx.DrawSprite( pos.x,pos.y,GetSpanAtlas().tileCross );
 }
 
 void SpriteCodex::DrawTileFlag( const Vei2& pos,Graphics& gfx )
 {
-	gfx.PutPixel( 7 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 8 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 5 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 6 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 7 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 8 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 4 + pos.x,5 + pos.y,255,0,0 );
-	gfx.PutPixel( 5 + pos.x,5 + pos.y,255,0,0 );
-	gfx.PutPixel( 6 + pos.x,5 + pos.y,255,0,0 );
-	gfx.PutPixel( 7 + pos.x,5 + pos.y,255,0,0 );
-	gfx.PutPixel( 8 + pos.x,5 + pos.y,255,0,0 );
-	gfx.PutPixel( 5 + pos.x,6 + pos.y,255,0,0 );
-	gfx.PutPixel( 6 + pos.x,6 + pos.y,255,0,0 );
-	gfx.PutPixel( 7 + pos.x,6 + pos.y,255,0,0 );
-	gfx.PutPixel( 8 + pos.x,6 + pos.y,255,0,0 );
-	gfx.PutPixel( 7 + pos.x,7 + pos.y,255,0,0 );
-	gfx.PutPixel( 8 + pos.x,7 + pos.y,255,0,0 );
-	gfx.PutPixel( 8 + pos.x,8 + pos.y,0,0,0 );
-	gfx.PutPixel( 8 + pos.x,9 + pos.y,0,0,0 );
-	gfx.PutPixel( 6 + pos.x,10 + pos.y,0,0,0 );
-	gfx.PutPixel( 7 + pos.x,10 + pos.y,0,0,0 );
-	gfx.PutPixel( 8 + pos.x,10 + pos.y,0,0,0 );
-	gfx.PutPixel( 9 + pos.x,10 + pos.y,0,0,0 );
-	gfx.PutPixel( 4 + pos.x,11 + pos.y,0,0,0 );
-	gfx.PutPixel( 5 + pos.x,11 + pos.y,0,0,0 );
-	gfx.PutPixel( 6 + pos.x,11 + pos.y,0,0,0 );
-	gfx.PutPixel( 7 + pos.x,11 + pos.y,0,0,0 );
-	gfx.PutPixel( 8 + pos.x,11 + pos.y,0,0,0 );
-	gfx.PutPixel( 9 + pos.x,11 + pos.y,0,0,0 );
-	gfx.PutPixel( 10 + pos.x,11 + pos.y,0,0,0 );
-	gfx.PutPixel( 11 + pos.x,11 + pos.y,0,0,0 );
-	gfx.PutPixel( 4 + pos.x,12 + pos.y,0,0,0 );
-	gfx.PutPixel( 5 + pos.x,12 + pos.y,0,0,0 );
-	gfx.PutPixel( 6 + pos.x,12 + pos.y,0,0,0 );
-	gfx.PutPixel( 7 + pos.x,12 + pos.y,0,0,0 );
-	gfx.PutPixel( 8 + pos.x,12 + pos.y,0,0,0 );
-	gfx.PutPixel( 9 + pos.x,12 + pos.y,0,0,0 );
-	gfx.PutPixel( 10 + pos.x,12 + pos.y,0,0,0 );
-	gfx.PutPixel( 11 + pos.x,12 + pos.y,0,0,0 );
+	gfx.DrawSprite( pos.x,pos.y,GetSpanAtlas().tileFlag );
 }
 
 void SpriteCodex::DrawTileBomb( const Vei2& pos,Graphics& gfx )
 {
-	gfx.PutPixel( 0 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 2 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,0 + pos.y,134,132,130 );
-	gfx.PutPixel( 5 + pos.x,0 + pos.y,129,123,119 );
-	gfx.PutPixel( 6 + pos.x,0 + pos.y,92,82,79 );
-	gfx.PutPixel( 7 + pos.x,0 + pos.y,114,102,95 );
-	gfx.PutPixel( 8 + pos.x,0 + pos.y,100,89,85 );
-	gfx.PutPixel( 9 + pos.x,0 + pos.y,118,110,105 );
-	gfx.PutPixel( 10 + pos.x,0 + pos.y,126,118,114 );
-	gfx.PutPixel( 11 + pos.x,0 + pos.y,137,134,132 );
-	gfx.PutPixel( 12 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 13 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 14 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,1 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,1 + pos.y,182,175,169 );
-	gfx.PutPixel( 4 + pos.x,1 + pos.y,121,107,100 );
-	gfx.PutPixel( 5 + pos.x,1 + pos.y,113,95,85 );
-	gfx.PutPixel( 6 + pos.x,1 + pos.y,99,84,76 );
-	gfx.PutPixel( 7 + pos.x,1 + pos.y,88,74,67 );
-	gfx.PutPixel( 8 + pos.x,1 + pos.y,90,78,73 );
-	gfx.PutPixel( 9 + pos.x,1 + pos.y,77,64,57 );
-	gfx.PutPixel( 10 + pos.x,1 + pos.y,87,70,61 );
-	gfx.PutPixel( 11 + pos.x,1 + pos.y,107,91,82 );
-	gfx.PutPixel( 12 + pos.x,1 + pos.y,150,143,141 );
-	gfx.PutPixel( 13 + pos.x,1 + pos.y,190,189,189 );
-	gfx.PutPixel( 0 + pos.x,2 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,2 + pos.y,191,189,188 );
-	gfx.PutPixel( 2 + pos.x,2 + pos.y,182,173,166 );
-	gfx.PutPixel( 3 + pos.x,2 + pos.y,118,99,89 );
-	gfx.PutPixel( 4 + pos.x,2 + pos.y,120,98,85 );
-	gfx.PutPixel( 5 + pos.x,2 + pos.y,131,104,86 );
-	gfx.PutPixel( 6 + pos.x,2 + pos.y,113,88,71 );
-	gfx.PutPixel( 7 + pos.x,2 + pos.y,84,65,56 );
-	gfx.PutPixel( 8 + pos.x,2 + pos.y,45,39,36 );
-	gfx.PutPixel( 9 + pos.x,2 + pos.y,52,43,40 );
-	gfx.PutPixel( 10 + pos.x,2 + pos.y,74,57,48 );
-	gfx.PutPixel( 11 + pos.x,2 + pos.y,51,45,40 );
-	gfx.PutPixel( 12 + pos.x,2 + pos.y,37,28,23 );
-	gfx.PutPixel( 13 + pos.x,2 + pos.y,147,142,136 );
-	gfx.PutPixel( 0 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,3 + pos.y,179,170,163 );
-	gfx.PutPixel( 2 + pos.x,3 + pos.y,151,131,116 );
-	gfx.PutPixel( 3 + pos.x,3 + pos.y,121,99,87 );
-	gfx.PutPixel( 4 + pos.x,3 + pos.y,98,76,62 );
-	gfx.PutPixel( 5 + pos.x,3 + pos.y,80,60,48 );
-	gfx.PutPixel( 6 + pos.x,3 + pos.y,58,45,37 );
-	gfx.PutPixel( 7 + pos.x,3 + pos.y,53,45,39 );
-	gfx.PutPixel( 8 + pos.x,3 + pos.y,61,44,39 );
-	gfx.PutPixel( 9 + pos.x,3 + pos.y,93,69,66 );
-	gfx.PutPixel( 10 + pos.x,3 + pos.y,84,57,50 );
-	gfx.PutPixel( 11 + pos.x,3 + pos.y,52,37,30 );
-	gfx.PutPixel( 12 + pos.x,3 + pos.y,20,19,18 );
-	gfx.PutPixel( 13 + pos.x,3 + pos.y,107,102,97 );
-	gfx.PutPixel( 0 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,4 + pos.y,143,131,116 );
-	gfx.PutPixel( 2 + pos.x,4 + pos.y,113,90,74 );
-	gfx.PutPixel( 3 + pos.x,4 + pos.y,90,70,58 );
-	gfx.PutPixel( 4 + pos.x,4 + pos.y,36,30,26 );
-	gfx.PutPixel( 5 + pos.x,4 + pos.y,36,29,25 );
-	gfx.PutPixel( 6 + pos.x,4 + pos.y,68,42,34 );
-	gfx.PutPixel( 7 + pos.x,4 + pos.y,82,49,39 );
-	gfx.PutPixel( 8 + pos.x,4 + pos.y,148,102,96 );
-	gfx.PutPixel( 9 + pos.x,4 + pos.y,177,125,119 );
-	gfx.PutPixel( 10 + pos.x,4 + pos.y,173,117,109 );
-	gfx.PutPixel( 11 + pos.x,4 + pos.y,123,78,70 );
-	gfx.PutPixel( 12 + pos.x,4 + pos.y,23,20,17 );
-	gfx.PutPixel( 13 + pos.x,4 + pos.y,84,80,77 );
-	gfx.PutPixel( 0 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,5 + pos.y,109,101,90 );
-	gfx.PutPixel( 2 + pos.x,5 + pos.y,62,49,39 );
-	gfx.PutPixel( 3 + pos.x,5 + pos.y,42,33,28 );
-	gfx.PutPixel( 4 + pos.x,5 + pos.y,29,26,25 );
-	gfx.PutPixel( 5 + pos.x,5 + pos.y,55,40,33 );
-	gfx.PutPixel( 6 + pos.x,5 + pos.y,136,83,69 );
-	gfx.PutPixel( 7 + pos.x,5 + pos.y,167,103,89 );
-	gfx.PutPixel( 8 + pos.x,5 + pos.y,194,143,137 );
-	gfx.PutPixel( 9 + pos.x,5 + pos.y,183,127,120 );
-	gfx.PutPixel( 10 + pos.x,5 + pos.y,175,115,106 );
-	gfx.PutPixel( 11 + pos.x,5 + pos.y,165,107,100 );
-	gfx.PutPixel( 12 + pos.x,5 + pos.y,79,52,44 );
-	gfx.PutPixel( 13 + pos.x,5 + pos.y,89,85,80 );
-	gfx.PutPixel( 0 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,6 + pos.y,129,122,114 );
-	gfx.PutPixel( 2 + pos.x,6 + pos.y,54,48,43 );
-	gfx.PutPixel( 3 + pos.x,6 + pos.y,26,24,23 );
-	gfx.PutPixel( 4 + pos.x,6 + pos.y,72,50,38 );
-	gfx.PutPixel( 5 + pos.x,6 + pos.y,144,96,78 );
-	gfx.PutPixel( 6 + pos.x,6 + pos.y,195,134,118 );
-	gfx.PutPixel( 7 + pos.x,6 + pos.y,210,150,136 );
-	gfx.PutPixel( 8 + pos.x,6 + pos.y,196,145,139 );
-	gfx.PutPixel( 9 + pos.x,6 + pos.y,176,121,113 );
-	gfx.PutPixel( 10 + pos.x,6 + pos.y,184,127,120 );
-	gfx.PutPixel( 11 + pos.x,6 + pos.y,178,113,109 );
-	gfx.PutPixel( 12 + pos.x,6 + pos.y,125,84,74 );
-	gfx.PutPixel( 13 + pos.x,6 + pos.y,87,84,81 );
-	gfx.PutPixel( 0 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,7 + pos.y,155,151,147 );
-	gfx.PutPixel( 2 + pos.x,7 + pos.y,78,75,71 );
-	gfx.PutPixel( 3 + pos.x,7 + pos.y,19,19,17 );
-	gfx.PutPixel( 4 + pos.x,7 + pos.y,127,87,73 );
-	gfx.PutPixel( 5 + pos.x,7 + pos.y,214,152,134 );
-	gfx.PutPixel( 6 + pos.x,7 + pos.y,200,151,132 );
-	gfx.PutPixel( 7 + pos.x,7 + pos.y,151,108,93 );
-	gfx.PutPixel( 8 + pos.x,7 + pos.y,121,75,64 );
-	gfx.PutPixel( 9 + pos.x,7 + pos.y,157,101,93 );
-	gfx.PutPixel( 10 + pos.x,7 + pos.y,141,93,84 );
-	gfx.PutPixel( 11 + pos.x,7 + pos.y,106,69,62 );
-	gfx.PutPixel( 12 + pos.x,7 + pos.y,101,70,58 );
-	gfx.PutPixel( 13 + pos.x,7 + pos.y,120,114,110 );
-	gfx.PutPixel( 0 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,8 + pos.y,193,163,159 );
-	gfx.PutPixel( 2 + pos.x,8 + pos.y,162,106,97 );
-	gfx.PutPixel( 3 + pos.x,8 + pos.y,50,36,27 );
-	gfx.PutPixel( 4 + pos.x,8 + pos.y,190,146,128 );
-	gfx.PutPixel( 5 + pos.x,8 + pos.y,190,139,119 );
-	gfx.PutPixel( 6 + pos.x,8 + pos.y,105,63,47 );
-	gfx.PutPixel( 7 + pos.x,8 + pos.y,64,36,31 );
-	gfx.PutPixel( 8 + pos.x,8 + pos.y,95,50,40 );
-	gfx.PutPixel( 9 + pos.x,8 + pos.y,172,122,110 );
-	gfx.PutPixel( 10 + pos.x,8 + pos.y,86,53,47 );
-	gfx.PutPixel( 11 + pos.x,8 + pos.y,42,25,20 );
-	gfx.PutPixel( 12 + pos.x,8 + pos.y,87,55,43 );
-	gfx.PutPixel( 13 + pos.x,8 + pos.y,159,153,149 );
-	gfx.PutPixel( 0 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,9 + pos.y,190,175,172 );
-	gfx.PutPixel( 2 + pos.x,9 + pos.y,190,133,125 );
-	gfx.PutPixel( 3 + pos.x,9 + pos.y,152,100,83 );
-	gfx.PutPixel( 4 + pos.x,9 + pos.y,188,138,121 );
-	gfx.PutPixel( 5 + pos.x,9 + pos.y,216,164,149 );
-	gfx.PutPixel( 6 + pos.x,9 + pos.y,201,156,142 );
-	gfx.PutPixel( 7 + pos.x,9 + pos.y,168,124,118 );
-	gfx.PutPixel( 8 + pos.x,9 + pos.y,178,127,115 );
-	gfx.PutPixel( 9 + pos.x,9 + pos.y,210,157,146 );
-	gfx.PutPixel( 10 + pos.x,9 + pos.y,153,108,105 );
-	gfx.PutPixel( 11 + pos.x,9 + pos.y,139,87,80 );
-	gfx.PutPixel( 12 + pos.x,9 + pos.y,149,101,96 );
-	gfx.PutPixel( 13 + pos.x,9 + pos.y,169,161,161 );
-	gfx.PutPixel( 0 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,10 + pos.y,192,191,191 );
-	gfx.PutPixel( 2 + pos.x,10 + pos.y,193,179,176 );
-	gfx.PutPixel( 3 + pos.x,10 + pos.y,217,162,145 );
-	gfx.PutPixel( 4 + pos.x,10 + pos.y,191,137,120 );
-	gfx.PutPixel( 5 + pos.x,10 + pos.y,199,137,121 );
-	gfx.PutPixel( 6 + pos.x,10 + pos.y,214,151,143 );
-	gfx.PutPixel( 7 + pos.x,10 + pos.y,201,148,142 );
-	gfx.PutPixel( 8 + pos.x,10 + pos.y,191,130,116 );
-	gfx.PutPixel( 9 + pos.x,10 + pos.y,216,161,149 );
-	gfx.PutPixel( 10 + pos.x,10 + pos.y,177,126,123 );
-	gfx.PutPixel( 11 + pos.x,10 + pos.y,157,97,90 );
-	gfx.PutPixel( 12 + pos.x,10 + pos.y,149,90,84 );
-	gfx.PutPixel( 13 + pos.x,10 + pos.y,167,160,160 );
-	gfx.PutPixel( 0 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 2 + pos.x,11 + pos.y,193,188,188 );
-	gfx.PutPixel( 3 + pos.x,11 + pos.y,194,143,133 );
-	gfx.PutPixel( 4 + pos.x,11 + pos.y,191,139,118 );
-	gfx.PutPixel( 5 + pos.x,11 + pos.y,187,135,114 );
-	gfx.PutPixel( 6 + pos.x,11 + pos.y,172,109,93 );
-	gfx.PutPixel( 7 + pos.x,11 + pos.y,166,102,91 );
-	gfx.PutPixel( 8 + pos.x,11 + pos.y,181,117,105 );
-	gfx.PutPixel( 9 + pos.x,11 + pos.y,145,89,75 );
-	gfx.PutPixel( 10 + pos.x,11 + pos.y,115,69,60 );
-	gfx.PutPixel( 11 + pos.x,11 + pos.y,123,76,68 );
-	gfx.PutPixel( 12 + pos.x,11 + pos.y,122,77,62 );
-	gfx.PutPixel( 13 + pos.x,11 + pos.y,170,166,166 );
-	gfx.PutPixel( 0 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,12 + pos.y,185,176,175 );
-	gfx.PutPixel( 4 + pos.x,12 + pos.y,173,124,107 );
-	gfx.PutPixel( 5 + pos.x,12 + pos.y,185,128,109 );
-	gfx.PutPixel( 6 + pos.x,12 + pos.y,184,136,115 );
-	gfx.PutPixel( 7 + pos.x,12 + pos.y,167,121,106 );
-	gfx.PutPixel( 8 + pos.x,12 + pos.y,160,102,93 );
-	gfx.PutPixel( 9 + pos.x,12 + pos.y,145,81,73 );
-	gfx.PutPixel( 10 + pos.x,12 + pos.y,97,51,47 );
-	gfx.PutPixel( 11 + pos.x,12 + pos.y,123,86,75 );
-	gfx.PutPixel( 12 + pos.x,12 + pos.y,134,101,89 );
-	gfx.PutPixel( 13 + pos.x,12 + pos.y,182,180,180 );
-	gfx.PutPixel( 0 + pos.x,13 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,13 + pos.y,170,150,145 );
-	gfx.PutPixel( 5 + pos.x,13 + pos.y,150,100,87 );
-	gfx.PutPixel( 6 + pos.x,13 + pos.y,153,100,85 );
-	gfx.PutPixel( 7 + pos.x,13 + pos.y,177,124,106 );
-	gfx.PutPixel( 8 + pos.x,13 + pos.y,184,122,111 );
-	gfx.PutPixel( 9 + pos.x,13 + pos.y,141,73,72 );
-	gfx.PutPixel( 10 + pos.x,13 + pos.y,130,75,71 );
-	gfx.PutPixel( 11 + pos.x,13 + pos.y,122,79,65 );
-	gfx.PutPixel( 12 + pos.x,13 + pos.y,154,143,142 );
-	gfx.PutPixel( 0 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 5 + pos.x,14 + pos.y,167,154,151 );
-	gfx.PutPixel( 6 + pos.x,14 + pos.y,128,92,80 );
-	gfx.PutPixel( 7 + pos.x,14 + pos.y,164,109,91 );
-	gfx.PutPixel( 8 + pos.x,14 + pos.y,184,124,109 );
-	gfx.PutPixel( 9 + pos.x,14 + pos.y,166,108,102 );
-	gfx.PutPixel( 10 + pos.x,14 + pos.y,148,91,81 );
-	gfx.PutPixel( 11 + pos.x,14 + pos.y,131,108,100 );
-	gfx.PutPixel( 12 + pos.x,14 + pos.y,190,190,190 );
-	gfx.PutPixel( 0 + pos.x,15 + pos.y,128,128,128 );
-	gfx.PutPixel( 6 + pos.x,15 + pos.y,182,177,175 );
-	gfx.PutPixel( 7 + pos.x,15 + pos.y,152,133,126 );
-	gfx.PutPixel( 8 + pos.x,15 + pos.y,129,93,86 );
-	gfx.PutPixel( 9 + pos.x,15 + pos.y,131,88,82 );
-	gfx.PutPixel( 10 + pos.x,15 + pos.y,125,96,91 );
-	gfx.PutPixel( 11 + pos.x,15 + pos.y,178,174,173 );
+	gfx.DrawSprite( pos.x,pos.y,GetSpanAtlas().tileBomb );
 }
 
 void SpriteCodex::DrawTileBombRed( const Vei2& pos,Graphics& gfx )
 {
-	gfx.PutPixel( 0 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 2 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 3 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 4 + pos.x,0 + pos.y,134,132,130 );
-	gfx.PutPixel( 5 + pos.x,0 + pos.y,129,123,119 );
-	gfx.PutPixel( 6 + pos.x,0 + pos.y,92,82,79 );
-	gfx.PutPixel( 7 + pos.x,0 + pos.y,114,102,95 );
-	gfx.PutPixel( 8 + pos.x,0 + pos.y,100,89,85 );
-	gfx.PutPixel( 9 + pos.x,0 + pos.y,118,110,105 );
-	gfx.PutPixel( 10 + pos.x,0 + pos.y,126,118,114 );
-	gfx.PutPixel( 11 + pos.x,0 + pos.y,137,134,132 );
-	gfx.PutPixel( 12 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 13 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 14 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 15 + pos.x,0 + pos.y,128,128,128 );
-	gfx.PutPixel( 0 + pos.x,1 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,1 + pos.y,255,0,0 );
-	gfx.PutPixel( 2 + pos.x,1 + pos.y,255,0,0 );
-	gfx.PutPixel( 3 + pos.x,1 + pos.y,220,59,53 );
-	gfx.PutPixel( 4 + pos.x,1 + pos.y,125,96,90 );
-	gfx.PutPixel( 5 + pos.x,1 + pos.y,113,95,85 );
-	gfx.PutPixel( 6 + pos.x,1 + pos.y,99,84,76 );
-	gfx.PutPixel( 7 + pos.x,1 + pos.y,88,74,67 );
-	gfx.PutPixel( 8 + pos.x,1 + pos.y,90,78,73 );
-	gfx.PutPixel( 9 + pos.x,1 + pos.y,77,64,57 );
-	gfx.PutPixel( 10 + pos.x,1 + pos.y,87,70,61 );
-	gfx.PutPixel( 11 + pos.x,1 + pos.y,108,89,80 );
-	gfx.PutPixel( 12 + pos.x,1 + pos.y,170,81,79 );
-	gfx.PutPixel( 13 + pos.x,1 + pos.y,250,7,7 );
-	gfx.PutPixel( 14 + pos.x,1 + pos.y,255,0,0 );
-	gfx.PutPixel( 15 + pos.x,1 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,2 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,2 + pos.y,249,12,11 );
-	gfx.PutPixel( 2 + pos.x,2 + pos.y,219,62,55 );
-	gfx.PutPixel( 3 + pos.x,2 + pos.y,118,99,89 );
-	gfx.PutPixel( 4 + pos.x,2 + pos.y,120,98,85 );
-	gfx.PutPixel( 5 + pos.x,2 + pos.y,131,104,86 );
-	gfx.PutPixel( 6 + pos.x,2 + pos.y,113,88,71 );
-	gfx.PutPixel( 7 + pos.x,2 + pos.y,84,65,56 );
-	gfx.PutPixel( 8 + pos.x,2 + pos.y,45,39,36 );
-	gfx.PutPixel( 9 + pos.x,2 + pos.y,52,43,40 );
-	gfx.PutPixel( 10 + pos.x,2 + pos.y,74,57,48 );
-	gfx.PutPixel( 11 + pos.x,2 + pos.y,51,45,40 );
-	gfx.PutPixel( 12 + pos.x,2 + pos.y,37,28,23 );
-	gfx.PutPixel( 13 + pos.x,2 + pos.y,183,34,29 );
-	gfx.PutPixel( 14 + pos.x,2 + pos.y,255,0,0 );
-	gfx.PutPixel( 15 + pos.x,2 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,3 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,3 + pos.y,218,53,46 );
-	gfx.PutPixel( 2 + pos.x,3 + pos.y,162,98,83 );
-	gfx.PutPixel( 3 + pos.x,3 + pos.y,121,99,87 );
-	gfx.PutPixel( 4 + pos.x,3 + pos.y,98,76,62 );
-	gfx.PutPixel( 5 + pos.x,3 + pos.y,80,60,48 );
-	gfx.PutPixel( 6 + pos.x,3 + pos.y,58,45,37 );
-	gfx.PutPixel( 7 + pos.x,3 + pos.y,53,45,39 );
-	gfx.PutPixel( 8 + pos.x,3 + pos.y,61,44,39 );
-	gfx.PutPixel( 9 + pos.x,3 + pos.y,93,69,66 );
-	gfx.PutPixel( 10 + pos.x,3 + pos.y,84,57,50 );
-	gfx.PutPixel( 11 + pos.x,3 + pos.y,52,37,30 );
-	gfx.PutPixel( 12 + pos.x,3 + pos.y,20,19,18 );
-	gfx.PutPixel( 13 + pos.x,3 + pos.y,131,29,24 );
-	gfx.PutPixel( 14 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 15 + pos.x,3 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,4 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,4 + pos.y,165,63,49 );
-	gfx.PutPixel( 2 + pos.x,4 + pos.y,114,86,71 );
-	gfx.PutPixel( 3 + pos.x,4 + pos.y,90,70,58 );
-	gfx.PutPixel( 4 + pos.x,4 + pos.y,36,30,26 );
-	gfx.PutPixel( 5 + pos.x,4 + pos.y,36,29,25 );
-	gfx.PutPixel( 6 + pos.x,4 + pos.y,68,42,34 );
-	gfx.PutPixel( 7 + pos.x,4 + pos.y,82,49,39 );
-	gfx.PutPixel( 8 + pos.x,4 + pos.y,148,102,96 );
-	gfx.PutPixel( 9 + pos.x,4 + pos.y,177,125,119 );
-	gfx.PutPixel( 10 + pos.x,4 + pos.y,173,117,109 );
-	gfx.PutPixel( 11 + pos.x,4 + pos.y,123,78,70 );
-	gfx.PutPixel( 12 + pos.x,4 + pos.y,23,20,17 );
-	gfx.PutPixel( 13 + pos.x,4 + pos.y,102,24,21 );
-	gfx.PutPixel( 14 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 15 + pos.x,4 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,5 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,5 + pos.y,126,50,39 );
-	gfx.PutPixel( 2 + pos.x,5 + pos.y,62,49,39 );
-	gfx.PutPixel( 3 + pos.x,5 + pos.y,42,33,28 );
-	gfx.PutPixel( 4 + pos.x,5 + pos.y,29,26,25 );
-	gfx.PutPixel( 5 + pos.x,5 + pos.y,55,40,33 );
-	gfx.PutPixel( 6 + pos.x,5 + pos.y,136,83,69 );
-	gfx.PutPixel( 7 + pos.x,5 + pos.y,167,103,89 );
-	gfx.PutPixel( 8 + pos.x,5 + pos.y,194,143,137 );
-	gfx.PutPixel( 9 + pos.x,5 + pos.y,183,127,120 );
-	gfx.PutPixel( 10 + pos.x,5 + pos.y,175,115,106 );
-	gfx.PutPixel( 11 + pos.x,5 + pos.y,165,107,100 );
-	gfx.PutPixel( 12 + pos.x,5 + pos.y,79,52,44 );
-	gfx.PutPixel( 13 + pos.x,5 + pos.y,108,27,22 );
-	gfx.PutPixel( 14 + pos.x,5 + pos.y,255,0,0 );
-	gfx.PutPixel( 15 + pos.x,5 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,6 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,6 + pos.y,154,44,36 );
-	gfx.PutPixel( 2 + pos.x,6 + pos.y,57,38,32 );
-	gfx.PutPixel( 3 + pos.x,6 + pos.y,26,24,23 );
-	gfx.PutPixel( 4 + pos.x,6 + pos.y,72,50,38 );
-	gfx.PutPixel( 5 + pos.x,6 + pos.y,144,96,78 );
-	gfx.PutPixel( 6 + pos.x,6 + pos.y,195,134,118 );
-	gfx.PutPixel( 7 + pos.x,6 + pos.y,210,150,136 );
-	gfx.PutPixel( 8 + pos.x,6 + pos.y,196,145,139 );
-	gfx.PutPixel( 9 + pos.x,6 + pos.y,176,121,113 );
-	gfx.PutPixel( 10 + pos.x,6 + pos.y,184,127,120 );
-	gfx.PutPixel( 11 + pos.x,6 + pos.y,178,113,109 );
-	gfx.PutPixel( 12 + pos.x,6 + pos.y,125,84,74 );
-	gfx.PutPixel( 13 + pos.x,6 + pos.y,107,22,18 );
-	gfx.PutPixel( 14 + pos.x,6 + pos.y,255,0,0 );
-	gfx.PutPixel( 15 + pos.x,6 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,7 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,7 + pos.y,193,36,32 );
-	gfx.PutPixel( 2 + pos.x,7 + pos.y,89,42,38 );
-	gfx.PutPixel( 3 + pos.x,7 + pos.y,19,19,17 );
-	gfx.PutPixel( 4 + pos.x,7 + pos.y,127,87,73 );
-	gfx.PutPixel( 5 + pos.x,7 + pos.y,214,152,134 );
-	gfx.PutPixel( 6 + pos.x,7 + pos.y,200,151,132 );
-	gfx.PutPixel( 7 + pos.x,7 + pos.y,151,108,93 );
-	gfx.PutPixel( 8 + pos.x,7 + pos.y,121,75,64 );
-	gfx.PutPixel( 9 + pos.x,7 + pos.y,157,101,93 );
-	gfx.PutPixel( 10 + pos.x,7 + pos.y,141,93,84 );
-	gfx.PutPixel( 11 + pos.x,7 + pos.y,106,69,62 );
-	gfx.PutPixel( 12 + pos.x,7 + pos.y,101,70,58 );
-	gfx.PutPixel( 13 + pos.x,7 + pos.y,146,34,30 );
-	gfx.PutPixel( 14 + pos.x,7 + pos.y,255,0,0 );
-	gfx.PutPixel( 15 + pos.x,7 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,8 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,8 + pos.y,227,60,56 );
-	gfx.PutPixel( 2 + pos.x,8 + pos.y,171,81,72 );
-	gfx.PutPixel( 3 + pos.x,8 + pos.y,50,36,27 );
-	gfx.PutPixel( 4 + pos.x,8 + pos.y,190,146,128 );
-	gfx.PutPixel( 5 + pos.x,8 + pos.y,190,139,119 );
-	gfx.PutPixel( 6 + pos.x,8 + pos.y,105,63,47 );
-	gfx.PutPixel( 7 + pos.x,8 + pos.y,64,36,31 );
-	gfx.PutPixel( 8 + pos.x,8 + pos.y,95,50,40 );
-	gfx.PutPixel( 9 + pos.x,8 + pos.y,172,122,110 );
-	gfx.PutPixel( 10 + pos.x,8 + pos.y,86,53,47 );
-	gfx.PutPixel( 11 + pos.x,8 + pos.y,42,25,20 );
-	gfx.PutPixel( 12 + pos.x,8 + pos.y,87,55,43 );
-	gfx.PutPixel( 13 + pos.x,8 + pos.y,195,42,39 );
-	gfx.PutPixel( 14 + pos.x,8 + pos.y,255,0,0 );
-	gfx.PutPixel( 15 + pos.x,8 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,9 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,9 + pos.y,229,55,52 );
-	gfx.PutPixel( 2 + pos.x,9 + pos.y,202,98,90 );
-	gfx.PutPixel( 3 + pos.x,9 + pos.y,152,100,83 );
-	gfx.PutPixel( 4 + pos.x,9 + pos.y,188,138,121 );
-	gfx.PutPixel( 5 + pos.x,9 + pos.y,216,164,149 );
-	gfx.PutPixel( 6 + pos.x,9 + pos.y,201,156,142 );
-	gfx.PutPixel( 7 + pos.x,9 + pos.y,168,124,118 );
-	gfx.PutPixel( 8 + pos.x,9 + pos.y,178,127,115 );
-	gfx.PutPixel( 9 + pos.x,9 + pos.y,210,157,146 );
-	gfx.PutPixel( 10 + pos.x,9 + pos.y,153,108,105 );
-	gfx.PutPixel( 11 + pos.x,9 + pos.y,139,87,80 );
-	gfx.PutPixel( 12 + pos.x,9 + pos.y,149,101,96 );
-	gfx.PutPixel( 13 + pos.x,9 + pos.y,212,32,31 );
-	gfx.PutPixel( 14 + pos.x,9 + pos.y,255,0,0 );
-	gfx.PutPixel( 15 + pos.x,9 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,10 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,10 + pos.y,251,10,10 );
-	gfx.PutPixel( 2 + pos.x,10 + pos.y,230,66,63 );
-	gfx.PutPixel( 3 + pos.x,10 + pos.y,217,162,145 );
-	gfx.PutPixel( 4 + pos.x,10 + pos.y,191,137,120 );
-	gfx.PutPixel( 5 + pos.x,10 + pos.y,199,137,121 );
-	gfx.PutPixel( 6 + pos.x,10 + pos.y,214,151,143 );
-	gfx.PutPixel( 7 + pos.x,10 + pos.y,201,148,142 );
-	gfx.PutPixel( 8 + pos.x,10 + pos.y,191,130,116 );
-	gfx.PutPixel( 9 + pos.x,10 + pos.y,216,161,149 );
-	gfx.PutPixel( 10 + pos.x,10 + pos.y,177,126,123 );
-	gfx.PutPixel( 11 + pos.x,10 + pos.y,157,97,90 );
-	gfx.PutPixel( 12 + pos.x,10 + pos.y,149,90,84 );
-	gfx.PutPixel( 13 + pos.x,10 + pos.y,211,25,25 );
-	gfx.PutPixel( 14 + pos.x,10 + pos.y,255,0,0 );
-	gfx.PutPixel( 15 + pos.x,10 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,11 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 2 + pos.x,11 + pos.y,249,17,16 );
-	gfx.PutPixel( 3 + pos.x,11 + pos.y,200,123,113 );
-	gfx.PutPixel( 4 + pos.x,11 + pos.y,191,139,118 );
-	gfx.PutPixel( 5 + pos.x,11 + pos.y,187,135,114 );
-	gfx.PutPixel( 6 + pos.x,11 + pos.y,172,109,93 );
-	gfx.PutPixel( 7 + pos.x,11 + pos.y,166,102,91 );
-	gfx.PutPixel( 8 + pos.x,11 + pos.y,181,117,105 );
-	gfx.PutPixel( 9 + pos.x,11 + pos.y,145,89,75 );
-	gfx.PutPixel( 10 + pos.x,11 + pos.y,115,69,60 );
-	gfx.PutPixel( 11 + pos.x,11 + pos.y,123,76,68 );
-	gfx.PutPixel( 12 + pos.x,11 + pos.y,122,77,62 );
-	gfx.PutPixel( 13 + pos.x,11 + pos.y,218,20,20 );
-	gfx.PutPixel( 14 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 15 + pos.x,11 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,12 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 2 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 3 + pos.x,12 + pos.y,236,19,17 );
-	gfx.PutPixel( 4 + pos.x,12 + pos.y,178,110,93 );
-	gfx.PutPixel( 5 + pos.x,12 + pos.y,185,128,109 );
-	gfx.PutPixel( 6 + pos.x,12 + pos.y,184,136,115 );
-	gfx.PutPixel( 7 + pos.x,12 + pos.y,167,121,106 );
-	gfx.PutPixel( 8 + pos.x,12 + pos.y,160,102,93 );
-	gfx.PutPixel( 9 + pos.x,12 + pos.y,145,81,73 );
-	gfx.PutPixel( 10 + pos.x,12 + pos.y,97,51,47 );
-	gfx.PutPixel( 11 + pos.x,12 + pos.y,123,86,75 );
-	gfx.PutPixel( 12 + pos.x,12 + pos.y,142,77,64 );
-	gfx.PutPixel( 13 + pos.x,12 + pos.y,238,10,11 );
-	gfx.PutPixel( 14 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 15 + pos.x,12 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,13 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,13 + pos.y,255,0,0 );
-	gfx.PutPixel( 2 + pos.x,13 + pos.y,255,0,0 );
-	gfx.PutPixel( 3 + pos.x,13 + pos.y,255,0,0 );
-	gfx.PutPixel( 4 + pos.x,13 + pos.y,206,40,35 );
-	gfx.PutPixel( 5 + pos.x,13 + pos.y,150,100,87 );
-	gfx.PutPixel( 6 + pos.x,13 + pos.y,153,100,85 );
-	gfx.PutPixel( 7 + pos.x,13 + pos.y,177,124,106 );
-	gfx.PutPixel( 8 + pos.x,13 + pos.y,184,122,111 );
-	gfx.PutPixel( 9 + pos.x,13 + pos.y,141,73,72 );
-	gfx.PutPixel( 10 + pos.x,13 + pos.y,130,75,71 );
-	gfx.PutPixel( 11 + pos.x,13 + pos.y,122,79,65 );
-	gfx.PutPixel( 12 + pos.x,13 + pos.y,185,49,47 );
-	gfx.PutPixel( 13 + pos.x,13 + pos.y,255,0,0 );
-	gfx.PutPixel( 14 + pos.x,13 + pos.y,255,0,0 );
-	gfx.PutPixel( 15 + pos.x,13 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,14 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,14 + pos.y,255,0,0 );
-	gfx.PutPixel( 2 + pos.x,14 + pos.y,255,0,0 );
-	gfx.PutPixel( 3 + pos.x,14 + pos.y,255,0,0 );
-	gfx.PutPixel( 4 + pos.x,14 + pos.y,255,0,0 );
-	gfx.PutPixel( 5 + pos.x,14 + pos.y,208,30,26 );
-	gfx.PutPixel( 6 + pos.x,14 + pos.y,133,77,65 );
-	gfx.PutPixel( 7 + pos.x,14 + pos.y,164,109,91 );
-	gfx.PutPixel( 8 + pos.x,14 + pos.y,184,124,109 );
-	gfx.PutPixel( 9 + pos.x,14 + pos.y,166,108,102 );
-	gfx.PutPixel( 10 + pos.x,14 + pos.y,148,91,81 );
-	gfx.PutPixel( 11 + pos.x,14 + pos.y,148,55,47 );
-	gfx.PutPixel( 12 + pos.x,14 + pos.y,251,3,3 );
-	gfx.PutPixel( 13 + pos.x,14 + pos.y,255,0,0 );
-	gfx.PutPixel( 14 + pos.x,14 + pos.y,255,0,0 );
-	gfx.PutPixel( 15 + pos.x,14 + pos.y,255,0,0 );
-	gfx.PutPixel( 0 + pos.x,15 + pos.y,128,128,128 );
-	gfx.PutPixel( 1 + pos.x,15 + pos.y,255,0,0 );
-	gfx.PutPixel( 2 + pos.x,15 + pos.y,255,0,0 );
-	gfx.PutPixel( 3 + pos.x,15 + pos.y,255,0,0 );
-	gfx.PutPixel( 4 + pos.x,15 + pos.y,255,0,0 );
-	gfx.PutPixel( 5 + pos.x,15 + pos.y,255,0,0 );
-	gfx.PutPixel( 6 + pos.x,15 + pos.y,236,11,10 );
-	gfx.PutPixel( 7 + pos.x,15 + pos.y,181,46,39 );
-	gfx.PutPixel( 8 + pos.x,15 + pos.y,136,72,65 );
-	gfx.PutPixel( 9 + pos.x,15 + pos.y,135,76,70 );
-	gfx.PutPixel( 10 + pos.x,15 + pos.y,140,49,44 );
-	gfx.PutPixel( 11 + pos.x,15 + pos.y,233,8,7 );
-	gfx.PutPixel( 12 + pos.x,15 + pos.y,255,0,0 );
-	gfx.PutPixel( 13 + pos.x,15 + pos.y,255,0,0 );
-	gfx.PutPixel( 14 + pos.x,15 + pos.y,255,0,0 );
-	gfx.PutPixel( 15 + pos.x,15 + pos.y,255,0,0 );
+	gfx.DrawSprite( pos.x,pos.y,GetSpanAtlas().tileBombRed );
 }
 
 void SpriteCodex::DrawTileNumber(const Vei2& pos, int number, Graphics& gfx)
 {
 	assert(number >= 0 && number <= 8);
-	switch (number)
-	{
-	case 0:
-		DrawTile0(pos, gfx);
-		break;
-	case 1:
-		DrawTile1(pos, gfx);
-		break;
-	case 2:
-		DrawTile2(pos, gfx);
-		break;
-	case 3:
-		DrawTile3(pos, gfx);
-		break;
-	case 4:
-		DrawTile4(pos, gfx);
-		break;
-	case 5:
-		DrawTile5(pos, gfx);
-		break;
-	case 6:
-		DrawTile6(pos, gfx);
-		break;
-	case 7:
-		DrawTile7(pos, gfx);
-		break;
-	case 8:
-		DrawTile8(pos, gfx);
-		break;
-	}
+	gfx.DrawSprite(pos.x, pos.y, GetSpanAtlas().tileNumbers[number]);
 }
 
 void SpriteCodex::DrawWin(const Vei2& pos, Graphics& gfx)
@@ -1515,7621 +124,5 @@ void SpriteCodex::DrawWin(const Vei2& pos, Graphics& gfx)
 	// calculate top left corner based on input (center)
 	const int x = pos.x - 254 / 2;
 	const int y = pos.y - 192 / 2;
-	gfx.PutPixel(9 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(10 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(11 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(12 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(13 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(14 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(15 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(16 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(17 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(18 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(27 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(28 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(29 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(30 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(31 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(32 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(33 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(34 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(35 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(36 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(43 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(44 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(45 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(46 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(53 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(54 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(55 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(56 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(63 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(64 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(65 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(66 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(67 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(68 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(69 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(70 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(71 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(72 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(79 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(80 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(81 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(82 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(83 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(84 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(85 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(86 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(87 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(88 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(89 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(90 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(99 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(100 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(101 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(102 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(103 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(104 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(105 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(106 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(107 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(108 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(115 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(116 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(117 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(118 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(119 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(120 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(121 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(122 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(123 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(124 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(125 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(126 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(131 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(132 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(133 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(134 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(141 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(142 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(143 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(144 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(150 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(151 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(152 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(153 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(154 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(155 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(156 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(157 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(158 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(159 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(160 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(161 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(170 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(171 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(172 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(173 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(174 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(175 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(176 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(177 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(178 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(179 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(186 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(187 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(188 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(189 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(190 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(191 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(192 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(193 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(194 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(195 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(196 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(197 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(202 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(203 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(204 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(205 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(206 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(207 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(208 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(209 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(216 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(217 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(218 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(219 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(220 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(221 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(222 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(223 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(224 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(225 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(232 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(233 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(234 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(235 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(242 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(243 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(244 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(245 + x, 6 + y, 222, 74, 0);
-	gfx.PutPixel(9 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(10 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(11 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(12 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(13 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(14 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(15 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(16 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(17 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(18 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(27 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(28 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(29 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(30 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(31 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(32 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(33 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(34 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(35 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(36 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(43 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(44 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(45 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(46 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(53 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(54 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(55 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(56 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(63 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(64 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(65 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(66 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(67 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(68 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(69 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(70 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(71 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(72 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(79 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(80 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(81 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(82 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(83 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(84 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(85 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(86 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(87 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(88 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(89 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(90 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(99 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(100 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(101 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(102 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(103 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(104 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(105 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(106 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(107 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(108 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(115 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(116 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(117 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(118 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(119 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(120 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(121 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(122 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(123 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(124 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(125 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(126 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(131 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(132 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(133 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(134 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(141 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(142 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(143 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(144 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(150 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(151 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(152 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(153 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(154 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(155 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(156 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(157 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(158 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(159 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(160 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(161 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(170 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(171 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(172 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(173 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(174 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(175 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(176 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(177 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(178 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(179 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(186 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(187 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(188 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(189 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(190 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(191 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(192 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(193 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(194 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(195 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(196 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(197 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(202 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(203 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(204 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(205 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(206 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(207 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(208 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(209 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(216 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(217 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(218 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(219 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(220 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(221 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(222 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(223 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(224 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(225 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(232 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(233 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(234 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(235 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(242 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(243 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(244 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(245 + x, 7 + y, 222, 74, 0);
-	gfx.PutPixel(7 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(8 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(9 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(10 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(11 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(12 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(13 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(14 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(15 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(16 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(17 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(18 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(19 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(20 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(25 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(26 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(27 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(28 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(29 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(30 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(31 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(32 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(33 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(34 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(35 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(36 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(37 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(38 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(43 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(44 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(45 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(46 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(47 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(48 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(53 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(54 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(55 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(56 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(57 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(58 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(61 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(62 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(63 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(64 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(65 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(66 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(67 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(68 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(69 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(70 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(71 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(72 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(73 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(74 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(79 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(80 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(81 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(82 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(83 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(84 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(85 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(86 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(87 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(88 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(89 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(90 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(91 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(92 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(97 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(98 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(99 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(100 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(101 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(102 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(103 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(104 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(105 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(106 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(107 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(108 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(109 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(110 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(117 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(118 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(119 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(120 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(121 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(122 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(123 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(124 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(125 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(126 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(127 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(128 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(131 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(132 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(133 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(134 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(135 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(136 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(141 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(142 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(143 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(144 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(145 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(146 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(150 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(151 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(152 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(153 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(154 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(155 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(156 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(157 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(158 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(159 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(160 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(161 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(162 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(163 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(168 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(169 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(170 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(171 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(172 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(173 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(174 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(175 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(176 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(177 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(178 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(179 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(180 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(181 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(188 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(189 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(190 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(191 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(192 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(193 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(194 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(195 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(196 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(197 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(198 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(199 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(204 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(205 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(206 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(207 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(208 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(209 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(210 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(211 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(214 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(215 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(216 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(217 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(218 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(219 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(220 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(221 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(222 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(223 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(224 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(225 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(226 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(227 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(232 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(233 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(234 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(235 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(236 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(237 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(242 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(243 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(244 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(245 + x, 8 + y, 222, 148, 0);
-	gfx.PutPixel(246 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(247 + x, 8 + y, 33, 0, 107);
-	gfx.PutPixel(7 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(8 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(9 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(10 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(11 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(12 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(13 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(14 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(15 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(16 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(17 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(18 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(19 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(20 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(25 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(26 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(27 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(28 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(29 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(30 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(31 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(32 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(33 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(34 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(35 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(36 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(37 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(38 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(43 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(44 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(45 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(46 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(47 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(48 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(53 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(54 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(55 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(56 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(57 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(58 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(61 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(62 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(63 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(64 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(65 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(66 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(67 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(68 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(69 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(70 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(71 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(72 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(73 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(74 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(79 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(80 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(81 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(82 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(83 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(84 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(85 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(86 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(87 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(88 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(89 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(90 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(91 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(92 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(97 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(98 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(99 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(100 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(101 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(102 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(103 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(104 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(105 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(106 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(107 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(108 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(109 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(110 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(117 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(118 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(119 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(120 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(121 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(122 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(123 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(124 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(125 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(126 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(127 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(128 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(131 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(132 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(133 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(134 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(135 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(136 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(141 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(142 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(143 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(144 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(145 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(146 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(150 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(151 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(152 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(153 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(154 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(155 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(156 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(157 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(158 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(159 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(160 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(161 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(162 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(163 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(168 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(169 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(170 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(171 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(172 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(173 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(174 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(175 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(176 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(177 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(178 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(179 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(180 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(181 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(188 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(189 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(190 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(191 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(192 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(193 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(194 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(195 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(196 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(197 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(198 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(199 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(204 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(205 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(206 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(207 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(208 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(209 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(210 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(211 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(214 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(215 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(216 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(217 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(218 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(219 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(220 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(221 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(222 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(223 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(224 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(225 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(226 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(227 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(232 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(233 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(234 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(235 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(236 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(237 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(242 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(243 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(244 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(245 + x, 9 + y, 222, 148, 0);
-	gfx.PutPixel(246 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(247 + x, 9 + y, 33, 0, 107);
-	gfx.PutPixel(7 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(8 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(9 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(10 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(11 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(12 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(19 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(20 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(21 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(22 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(25 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(26 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(27 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(28 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(29 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(30 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(35 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(36 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(37 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(38 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(39 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(40 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(43 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(44 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(45 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(46 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(47 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(48 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(49 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(50 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(53 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(54 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(55 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(56 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(57 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(58 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(61 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(62 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(63 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(64 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(65 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(66 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(73 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(74 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(75 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(76 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(79 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(80 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(81 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(82 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(83 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(84 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(89 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(90 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(91 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(92 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(93 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(94 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(97 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(98 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(99 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(100 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(101 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(102 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(107 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(108 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(109 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(110 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(111 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(112 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(119 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(120 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(121 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(122 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(123 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(124 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(131 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(132 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(133 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(134 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(135 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(136 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(141 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(142 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(143 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(144 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(145 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(146 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(150 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(151 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(152 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(153 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(154 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(155 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(160 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(161 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(162 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(163 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(164 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(165 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(168 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(169 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(170 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(171 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(172 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(173 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(178 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(179 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(180 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(181 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(182 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(183 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(190 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(191 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(192 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(193 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(194 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(195 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(204 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(205 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(206 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(207 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(208 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(209 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(214 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(215 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(216 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(217 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(218 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(219 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(224 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(225 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(226 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(227 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(228 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(229 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(232 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(233 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(234 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(235 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(236 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(237 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(238 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(239 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(242 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(243 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(244 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(245 + x, 10 + y, 255, 222, 0);
-	gfx.PutPixel(246 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(247 + x, 10 + y, 33, 0, 107);
-	gfx.PutPixel(7 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(8 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(9 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(10 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(11 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(12 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(19 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(20 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(21 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(22 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(25 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(26 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(27 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(28 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(29 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(30 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(35 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(36 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(37 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(38 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(39 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(40 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(43 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(44 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(45 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(46 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(47 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(48 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(49 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(50 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(53 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(54 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(55 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(56 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(57 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(58 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(61 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(62 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(63 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(64 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(65 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(66 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(73 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(74 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(75 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(76 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(79 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(80 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(81 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(82 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(83 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(84 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(89 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(90 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(91 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(92 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(93 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(94 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(97 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(98 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(99 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(100 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(101 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(102 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(107 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(108 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(109 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(110 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(111 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(112 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(119 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(120 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(121 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(122 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(123 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(124 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(131 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(132 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(133 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(134 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(135 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(136 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(141 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(142 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(143 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(144 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(145 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(146 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(150 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(151 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(152 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(153 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(154 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(155 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(160 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(161 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(162 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(163 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(164 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(165 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(168 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(169 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(170 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(171 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(172 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(173 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(178 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(179 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(180 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(181 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(182 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(183 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(190 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(191 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(192 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(193 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(194 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(195 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(204 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(205 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(206 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(207 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(208 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(209 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(214 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(215 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(216 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(217 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(218 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(219 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(224 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(225 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(226 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(227 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(228 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(229 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(232 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(233 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(234 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(235 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(236 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(237 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(238 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(239 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(242 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(243 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(244 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(245 + x, 11 + y, 255, 222, 0);
-	gfx.PutPixel(246 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(247 + x, 11 + y, 33, 0, 107);
-	gfx.PutPixel(7 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(8 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(9 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(10 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(11 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(12 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(25 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(26 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(27 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(28 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(29 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(30 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(35 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(36 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(37 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(38 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(39 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(40 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(43 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(44 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(45 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(46 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(47 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(48 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(49 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(50 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(51 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(52 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(53 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(54 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(55 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(56 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(57 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(58 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(61 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(62 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(63 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(64 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(65 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(66 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(67 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(68 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(69 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(70 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(71 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(72 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(73 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(74 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(79 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(80 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(81 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(82 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(83 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(84 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(85 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(86 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(87 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(88 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(89 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(90 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(91 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(92 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(93 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(94 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(97 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(98 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(99 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(100 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(101 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(102 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(106 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(112 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(119 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(124 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(131 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(136 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(141 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(145 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(146 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(150 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(153 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(154 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(155 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(156 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(157 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(162 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(163 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(164 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(165 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(168 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(172 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(173 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(174 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(175 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(176 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(177 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(178 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(179 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(180 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(181 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(182 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(183 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(190 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(191 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(192 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(193 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(194 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(195 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(204 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(205 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(206 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(207 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(208 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(209 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(214 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(215 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(216 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(217 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(218 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(219 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(224 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(225 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(226 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(227 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(228 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(229 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(232 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(233 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(234 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(235 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(236 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(237 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(238 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(239 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(240 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(241 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(242 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(243 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(244 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(245 + x, 12 + y, 255, 255, 255);
-	gfx.PutPixel(246 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(247 + x, 12 + y, 33, 0, 107);
-	gfx.PutPixel(7 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(8 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(9 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(10 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(11 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(12 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(25 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(26 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(27 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(28 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(29 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(30 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(35 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(36 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(37 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(38 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(39 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(40 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(43 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(44 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(45 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(46 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(47 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(48 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(49 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(50 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(51 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(52 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(53 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(54 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(55 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(56 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(57 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(58 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(61 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(62 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(63 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(64 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(65 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(66 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(67 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(68 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(69 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(70 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(71 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(72 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(73 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(74 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(79 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(80 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(81 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(82 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(83 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(84 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(85 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(86 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(87 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(88 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(89 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(90 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(91 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(92 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(93 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(94 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(97 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(98 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(99 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(100 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(101 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(102 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(106 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(112 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(119 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(124 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(131 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(136 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(141 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(145 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(146 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(150 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(153 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(154 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(155 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(156 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(157 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(162 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(163 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(164 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(165 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(168 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(172 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(173 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(174 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(175 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(176 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(177 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(178 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(179 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(180 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(181 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(182 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(183 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(190 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(191 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(192 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(193 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(194 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(195 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(204 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(205 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(206 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(207 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(208 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(209 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(214 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(215 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(216 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(217 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(218 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(219 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(224 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(225 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(226 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(227 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(228 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(229 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(232 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(233 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(234 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(235 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(236 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(237 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(238 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(239 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(240 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(241 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(242 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(243 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(244 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(245 + x, 13 + y, 255, 255, 255);
-	gfx.PutPixel(246 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(247 + x, 13 + y, 33, 0, 107);
-	gfx.PutPixel(7 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(8 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(9 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(10 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(11 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(12 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(25 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(26 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(27 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(28 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(29 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(30 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(35 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(36 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(37 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(38 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(39 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(40 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(43 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(44 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(45 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(46 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(47 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(48 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(51 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(52 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(53 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(54 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(55 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(56 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(57 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(58 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(61 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(62 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(63 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(64 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(65 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(66 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(67 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(68 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(69 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(70 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(71 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(72 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(73 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(74 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(75 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(76 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(79 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(80 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(81 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(82 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(83 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(84 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(85 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(86 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(87 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(88 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(89 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(90 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(91 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(92 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(97 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(98 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(99 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(100 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(101 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(102 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(103 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(104 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(105 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(106 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(107 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(108 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(109 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(110 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(111 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(112 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(119 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(120 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(121 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(122 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(123 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(124 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(131 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(132 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(133 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(134 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(135 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(136 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(141 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(142 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(143 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(144 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(145 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(146 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(150 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(151 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(152 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(153 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(154 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(155 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(156 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(157 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(158 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(159 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(160 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(161 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(162 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(163 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(168 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(169 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(170 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(171 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(172 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(173 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(174 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(175 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(176 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(177 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(178 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(179 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(180 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(181 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(182 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(183 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(190 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(191 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(192 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(193 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(194 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(195 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(204 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(205 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(206 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(207 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(208 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(209 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(214 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(215 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(216 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(217 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(218 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(219 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(224 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(225 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(226 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(227 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(228 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(229 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(232 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(233 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(234 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(235 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(236 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(237 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(240 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(241 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(242 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(243 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(244 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(245 + x, 14 + y, 255, 222, 0);
-	gfx.PutPixel(246 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(247 + x, 14 + y, 33, 0, 107);
-	gfx.PutPixel(7 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(8 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(9 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(10 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(11 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(12 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(25 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(26 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(27 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(28 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(29 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(30 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(35 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(36 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(37 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(38 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(39 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(40 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(43 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(44 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(45 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(46 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(47 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(48 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(51 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(52 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(53 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(54 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(55 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(56 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(57 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(58 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(61 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(62 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(63 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(64 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(65 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(66 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(67 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(68 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(69 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(70 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(71 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(72 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(73 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(74 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(75 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(76 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(79 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(80 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(81 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(82 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(83 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(84 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(85 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(86 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(87 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(88 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(89 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(90 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(91 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(92 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(97 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(98 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(99 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(100 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(101 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(102 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(103 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(104 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(105 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(106 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(107 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(108 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(109 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(110 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(111 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(112 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(119 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(120 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(121 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(122 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(123 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(124 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(131 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(132 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(133 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(134 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(135 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(136 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(141 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(142 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(143 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(144 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(145 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(146 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(150 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(151 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(152 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(153 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(154 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(155 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(156 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(157 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(158 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(159 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(160 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(161 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(162 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(163 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(168 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(169 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(170 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(171 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(172 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(173 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(174 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(175 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(176 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(177 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(178 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(179 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(180 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(181 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(182 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(183 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(190 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(191 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(192 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(193 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(194 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(195 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(204 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(205 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(206 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(207 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(208 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(209 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(214 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(215 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(216 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(217 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(218 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(219 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(224 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(225 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(226 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(227 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(228 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(229 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(232 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(233 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(234 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(235 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(236 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(237 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(240 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(241 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(242 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(243 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(244 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(245 + x, 15 + y, 255, 222, 0);
-	gfx.PutPixel(246 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(247 + x, 15 + y, 33, 0, 107);
-	gfx.PutPixel(7 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(8 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(9 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(10 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(11 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(12 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(17 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(18 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(19 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(20 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(25 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(26 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(27 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(28 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(29 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(30 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(35 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(36 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(37 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(38 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(39 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(40 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(43 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(44 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(45 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(46 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(47 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(48 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(53 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(54 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(55 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(56 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(57 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(58 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(61 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(62 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(63 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(64 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(65 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(66 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(71 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(72 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(73 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(74 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(75 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(76 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(79 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(80 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(81 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(82 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(83 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(84 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(89 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(90 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(91 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(92 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(93 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(94 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(97 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(98 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(99 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(100 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(101 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(102 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(107 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(108 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(109 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(110 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(111 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(112 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(119 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(120 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(121 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(122 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(123 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(124 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(131 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(132 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(133 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(134 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(135 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(136 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(141 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(142 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(143 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(144 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(145 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(146 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(150 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(151 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(152 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(153 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(154 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(155 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(160 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(161 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(162 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(163 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(164 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(165 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(168 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(169 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(170 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(171 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(172 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(173 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(178 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(179 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(180 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(181 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(182 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(183 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(190 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(191 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(192 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(193 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(194 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(195 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(204 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(205 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(206 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(207 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(208 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(209 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(214 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(215 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(216 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(217 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(218 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(219 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(224 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(225 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(226 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(227 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(228 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(229 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(232 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(233 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(234 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(235 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(236 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(237 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(242 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(243 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(244 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(245 + x, 16 + y, 222, 148, 0);
-	gfx.PutPixel(246 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(247 + x, 16 + y, 33, 0, 107);
-	gfx.PutPixel(7 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(8 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(9 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(10 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(11 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(12 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(17 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(18 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(19 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(20 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(25 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(26 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(27 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(28 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(29 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(30 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(35 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(36 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(37 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(38 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(39 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(40 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(43 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(44 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(45 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(46 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(47 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(48 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(53 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(54 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(55 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(56 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(57 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(58 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(61 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(62 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(63 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(64 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(65 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(66 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(71 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(72 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(73 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(74 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(75 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(76 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(79 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(80 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(81 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(82 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(83 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(84 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(89 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(90 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(91 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(92 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(93 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(94 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(97 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(98 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(99 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(100 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(101 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(102 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(107 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(108 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(109 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(110 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(111 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(112 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(119 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(120 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(121 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(122 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(123 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(124 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(131 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(132 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(133 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(134 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(135 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(136 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(141 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(142 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(143 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(144 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(145 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(146 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(150 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(151 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(152 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(153 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(154 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(155 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(160 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(161 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(162 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(163 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(164 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(165 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(168 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(169 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(170 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(171 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(172 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(173 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(178 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(179 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(180 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(181 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(182 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(183 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(190 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(191 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(192 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(193 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(194 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(195 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(204 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(205 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(206 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(207 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(208 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(209 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(214 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(215 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(216 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(217 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(218 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(219 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(224 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(225 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(226 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(227 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(228 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(229 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(232 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(233 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(234 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(235 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(236 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(237 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(242 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(243 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(244 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(245 + x, 17 + y, 222, 148, 0);
-	gfx.PutPixel(246 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(247 + x, 17 + y, 33, 0, 107);
-	gfx.PutPixel(9 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(10 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(11 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(12 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(13 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(14 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(15 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(16 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(17 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(18 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(19 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(20 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(21 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(22 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(27 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(28 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(29 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(30 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(31 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(32 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(33 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(34 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(35 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(36 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(37 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(38 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(39 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(40 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(43 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(44 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(45 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(46 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(47 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(48 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(53 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(54 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(55 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(56 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(57 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(58 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(63 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(64 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(65 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(66 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(67 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(68 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(69 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(70 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(71 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(72 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(73 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(74 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(75 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(76 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(79 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(80 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(81 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(82 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(83 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(84 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(89 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(90 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(91 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(92 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(93 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(94 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(97 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(98 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(99 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(100 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(101 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(102 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(107 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(108 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(109 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(110 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(111 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(112 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(119 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(120 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(121 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(122 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(123 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(124 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(133 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(134 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(135 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(136 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(137 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(138 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(139 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(140 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(141 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(142 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(143 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(144 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(145 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(146 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(150 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(151 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(152 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(153 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(154 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(155 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(160 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(161 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(162 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(163 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(164 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(165 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(168 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(169 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(170 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(171 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(172 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(173 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(178 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(179 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(180 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(181 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(182 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(183 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(190 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(191 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(192 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(193 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(194 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(195 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(202 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(203 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(204 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(205 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(206 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(207 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(208 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(209 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(216 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(217 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(218 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(219 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(220 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(221 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(222 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(223 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(224 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(225 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(226 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(227 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(228 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(229 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(232 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(233 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(234 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(235 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(236 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(237 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(242 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(243 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(244 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(245 + x, 18 + y, 222, 74, 0);
-	gfx.PutPixel(246 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(247 + x, 18 + y, 33, 0, 107);
-	gfx.PutPixel(9 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(10 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(11 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(12 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(13 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(14 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(15 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(16 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(17 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(18 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(19 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(20 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(21 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(22 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(27 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(28 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(29 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(30 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(31 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(32 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(33 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(34 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(35 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(36 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(37 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(38 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(39 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(40 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(43 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(44 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(45 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(46 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(47 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(48 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(53 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(54 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(55 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(56 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(57 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(58 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(63 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(64 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(65 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(66 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(67 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(68 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(69 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(70 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(71 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(72 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(73 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(74 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(75 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(76 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(79 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(80 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(81 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(82 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(83 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(84 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(89 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(90 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(91 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(92 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(93 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(94 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(97 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(98 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(99 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(100 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(101 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(102 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(107 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(108 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(109 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(110 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(111 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(112 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(119 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(120 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(121 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(122 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(123 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(124 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(133 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(134 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(135 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(136 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(137 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(138 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(139 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(140 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(141 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(142 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(143 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(144 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(145 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(146 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(150 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(151 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(152 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(153 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(154 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(155 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(160 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(161 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(162 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(163 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(164 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(165 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(168 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(169 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(170 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(171 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(172 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(173 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(178 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(179 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(180 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(181 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(182 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(183 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(190 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(191 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(192 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(193 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(194 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(195 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(202 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(203 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(204 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(205 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(206 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(207 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(208 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(209 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(216 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(217 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(218 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(219 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(220 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(221 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(222 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(223 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(224 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(225 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(226 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(227 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(228 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(229 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(232 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(233 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(234 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(235 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(236 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(237 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(242 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(243 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(244 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(245 + x, 19 + y, 222, 74, 0);
-	gfx.PutPixel(246 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(247 + x, 19 + y, 33, 0, 107);
-	gfx.PutPixel(11 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(12 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(13 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(14 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(15 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(16 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(17 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(18 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(19 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(20 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(29 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(30 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(31 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(32 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(33 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(34 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(35 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(36 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(37 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(38 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(45 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(46 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(47 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(48 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(55 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(56 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(57 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(58 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(65 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(66 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(67 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(68 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(69 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(70 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(71 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(72 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(73 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(74 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(81 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(82 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(83 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(84 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(91 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(92 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(93 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(94 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(99 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(100 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(101 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(102 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(109 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(110 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(111 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(112 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(121 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(122 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(123 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(124 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(135 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(136 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(137 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(138 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(139 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(140 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(141 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(142 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(143 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(144 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(152 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(153 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(154 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(155 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(162 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(163 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(164 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(165 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(170 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(171 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(172 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(173 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(180 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(181 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(182 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(183 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(192 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(193 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(194 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(195 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(204 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(205 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(206 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(207 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(208 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(209 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(210 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(211 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(218 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(219 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(220 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(221 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(222 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(223 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(224 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(225 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(226 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(227 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(234 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(235 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(236 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(237 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(244 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(245 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(246 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(247 + x, 20 + y, 33, 0, 107);
-	gfx.PutPixel(11 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(12 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(13 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(14 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(15 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(16 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(17 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(18 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(19 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(20 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(29 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(30 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(31 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(32 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(33 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(34 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(35 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(36 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(37 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(38 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(45 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(46 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(47 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(48 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(55 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(56 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(57 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(58 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(65 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(66 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(67 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(68 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(69 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(70 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(71 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(72 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(73 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(74 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(81 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(82 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(83 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(84 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(91 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(92 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(93 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(94 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(99 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(100 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(101 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(102 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(109 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(110 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(111 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(112 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(121 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(122 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(123 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(124 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(135 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(136 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(137 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(138 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(139 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(140 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(141 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(142 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(143 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(144 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(152 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(153 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(154 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(155 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(162 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(163 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(164 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(165 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(170 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(171 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(172 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(173 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(180 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(181 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(182 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(183 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(192 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(193 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(194 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(195 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(204 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(205 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(206 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(207 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(208 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(209 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(210 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(211 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(218 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(219 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(220 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(221 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(222 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(223 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(224 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(225 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(226 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(227 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(234 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(235 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(236 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(237 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(244 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(245 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(246 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(247 + x, 21 + y, 33, 0, 107);
-	gfx.PutPixel(102 + x, 31 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 31 + y, 80, 55, 63);
-	gfx.PutPixel(104 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(105 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(106 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(107 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(108 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(109 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(110 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(111 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(112 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(113 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(114 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(115 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(116 + x, 31 + y, 80, 55, 63);
-	gfx.PutPixel(117 + x, 31 + y, 87, 59, 68);
-	gfx.PutPixel(118 + x, 31 + y, 87, 55, 56);
-	gfx.PutPixel(119 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(120 + x, 31 + y, 79, 48, 0);
-	gfx.PutPixel(121 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(122 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(123 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(124 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(125 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(126 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(127 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(128 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(129 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(130 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(131 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(132 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(133 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(134 + x, 31 + y, 80, 55, 64);
-	gfx.PutPixel(135 + x, 31 + y, 78, 47, 59);
-	gfx.PutPixel(136 + x, 31 + y, 48, 48, 48);
-	gfx.PutPixel(102 + x, 32 + y, 112, 119, 112);
-	gfx.PutPixel(103 + x, 32 + y, 48, 48, 48);
-	gfx.PutPixel(104 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(105 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(106 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(107 + x, 32 + y, 112, 112, 0);
-	gfx.PutPixel(108 + x, 32 + y, 127, 120, 95);
-	gfx.PutPixel(109 + x, 32 + y, 128, 135, 96);
-	gfx.PutPixel(110 + x, 32 + y, 127, 120, 95);
-	gfx.PutPixel(111 + x, 32 + y, 112, 103, 47);
-	gfx.PutPixel(112 + x, 32 + y, 95, 87, 79);
-	gfx.PutPixel(113 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(114 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(115 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(116 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(117 + x, 32 + y, 80, 55, 63);
-	gfx.PutPixel(118 + x, 32 + y, 95, 63, 0);
-	gfx.PutPixel(119 + x, 32 + y, 92, 60, 36);
-	gfx.PutPixel(120 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(121 + x, 32 + y, 79, 48, 0);
-	gfx.PutPixel(122 + x, 32 + y, 87, 55, 56);
-	gfx.PutPixel(123 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(124 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(125 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(126 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(127 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(128 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(129 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(130 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(131 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(132 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(133 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(134 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(135 + x, 32 + y, 80, 55, 64);
-	gfx.PutPixel(136 + x, 32 + y, 80, 55, 63);
-	gfx.PutPixel(137 + x, 32 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 33 + y, 112, 119, 112);
-	gfx.PutPixel(104 + x, 33 + y, 48, 48, 48);
-	gfx.PutPixel(105 + x, 33 + y, 93, 56, 70);
-	gfx.PutPixel(106 + x, 33 + y, 95, 63, 64);
-	gfx.PutPixel(107 + x, 33 + y, 95, 63, 64);
-	gfx.PutPixel(108 + x, 33 + y, 112, 112, 0);
-	gfx.PutPixel(109 + x, 33 + y, 160, 160, 0);
-	gfx.PutPixel(110 + x, 33 + y, 191, 184, 0);
-	gfx.PutPixel(111 + x, 33 + y, 159, 159, 0);
-	gfx.PutPixel(112 + x, 33 + y, 127, 120, 95);
-	gfx.PutPixel(113 + x, 33 + y, 96, 96, 0);
-	gfx.PutPixel(114 + x, 33 + y, 95, 63, 64);
-	gfx.PutPixel(115 + x, 33 + y, 95, 56, 64);
-	gfx.PutPixel(116 + x, 33 + y, 95, 56, 64);
-	gfx.PutPixel(117 + x, 33 + y, 87, 55, 56);
-	gfx.PutPixel(118 + x, 33 + y, 80, 55, 64);
-	gfx.PutPixel(119 + x, 33 + y, 119, 77, 47);
-	gfx.PutPixel(120 + x, 33 + y, 95, 63, 0);
-	gfx.PutPixel(121 + x, 33 + y, 95, 63, 0);
-	gfx.PutPixel(122 + x, 33 + y, 79, 48, 0);
-	gfx.PutPixel(123 + x, 33 + y, 93, 56, 70);
-	gfx.PutPixel(124 + x, 33 + y, 87, 55, 56);
-	gfx.PutPixel(125 + x, 33 + y, 80, 55, 64);
-	gfx.PutPixel(126 + x, 33 + y, 87, 55, 56);
-	gfx.PutPixel(127 + x, 33 + y, 80, 55, 64);
-	gfx.PutPixel(128 + x, 33 + y, 87, 55, 56);
-	gfx.PutPixel(129 + x, 33 + y, 80, 55, 64);
-	gfx.PutPixel(130 + x, 33 + y, 87, 55, 56);
-	gfx.PutPixel(131 + x, 33 + y, 80, 55, 64);
-	gfx.PutPixel(132 + x, 33 + y, 87, 55, 56);
-	gfx.PutPixel(133 + x, 33 + y, 80, 55, 64);
-	gfx.PutPixel(134 + x, 33 + y, 87, 55, 56);
-	gfx.PutPixel(135 + x, 33 + y, 80, 55, 64);
-	gfx.PutPixel(136 + x, 33 + y, 87, 55, 56);
-	gfx.PutPixel(137 + x, 33 + y, 80, 55, 64);
-	gfx.PutPixel(138 + x, 33 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 34 + y, 159, 159, 208);
-	gfx.PutPixel(104 + x, 34 + y, 112, 119, 112);
-	gfx.PutPixel(105 + x, 34 + y, 48, 48, 48);
-	gfx.PutPixel(106 + x, 34 + y, 95, 63, 64);
-	gfx.PutPixel(107 + x, 34 + y, 111, 56, 80);
-	gfx.PutPixel(108 + x, 34 + y, 112, 63, 96);
-	gfx.PutPixel(109 + x, 34 + y, 127, 120, 95);
-	gfx.PutPixel(110 + x, 34 + y, 175, 175, 0);
-	gfx.PutPixel(111 + x, 34 + y, 223, 223, 0);
-	gfx.PutPixel(112 + x, 34 + y, 176, 176, 64);
-	gfx.PutPixel(113 + x, 34 + y, 143, 143, 32);
-	gfx.PutPixel(114 + x, 34 + y, 96, 103, 0);
-	gfx.PutPixel(115 + x, 34 + y, 111, 56, 80);
-	gfx.PutPixel(116 + x, 34 + y, 99, 57, 77);
-	gfx.PutPixel(117 + x, 34 + y, 96, 56, 79);
-	gfx.PutPixel(118 + x, 34 + y, 93, 56, 70);
-	gfx.PutPixel(119 + x, 34 + y, 80, 55, 64);
-	gfx.PutPixel(120 + x, 34 + y, 128, 87, 0);
-	gfx.PutPixel(121 + x, 34 + y, 95, 63, 0);
-	gfx.PutPixel(122 + x, 34 + y, 96, 64, 0);
-	gfx.PutPixel(123 + x, 34 + y, 79, 48, 0);
-	gfx.PutPixel(124 + x, 34 + y, 99, 57, 77);
-	gfx.PutPixel(125 + x, 34 + y, 87, 55, 56);
-	gfx.PutPixel(126 + x, 34 + y, 93, 56, 70);
-	gfx.PutPixel(127 + x, 34 + y, 87, 55, 56);
-	gfx.PutPixel(128 + x, 34 + y, 93, 56, 70);
-	gfx.PutPixel(129 + x, 34 + y, 87, 55, 56);
-	gfx.PutPixel(130 + x, 34 + y, 93, 56, 70);
-	gfx.PutPixel(131 + x, 34 + y, 87, 55, 56);
-	gfx.PutPixel(132 + x, 34 + y, 93, 56, 70);
-	gfx.PutPixel(133 + x, 34 + y, 87, 55, 56);
-	gfx.PutPixel(134 + x, 34 + y, 93, 56, 70);
-	gfx.PutPixel(135 + x, 34 + y, 87, 55, 56);
-	gfx.PutPixel(136 + x, 34 + y, 93, 56, 70);
-	gfx.PutPixel(137 + x, 34 + y, 87, 55, 56);
-	gfx.PutPixel(138 + x, 34 + y, 87, 55, 56);
-	gfx.PutPixel(139 + x, 34 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 35 + y, 176, 183, 223);
-	gfx.PutPixel(104 + x, 35 + y, 159, 159, 208);
-	gfx.PutPixel(105 + x, 35 + y, 112, 119, 112);
-	gfx.PutPixel(106 + x, 35 + y, 48, 48, 48);
-	gfx.PutPixel(107 + x, 35 + y, 112, 63, 96);
-	gfx.PutPixel(108 + x, 35 + y, 127, 63, 96);
-	gfx.PutPixel(109 + x, 35 + y, 112, 63, 96);
-	gfx.PutPixel(110 + x, 35 + y, 127, 120, 95);
-	gfx.PutPixel(111 + x, 35 + y, 175, 175, 0);
-	gfx.PutPixel(112 + x, 35 + y, 208, 208, 0);
-	gfx.PutPixel(113 + x, 35 + y, 176, 176, 64);
-	gfx.PutPixel(114 + x, 35 + y, 143, 143, 32);
-	gfx.PutPixel(115 + x, 35 + y, 96, 103, 0);
-	gfx.PutPixel(116 + x, 35 + y, 112, 63, 96);
-	gfx.PutPixel(117 + x, 35 + y, 111, 56, 76);
-	gfx.PutPixel(118 + x, 35 + y, 99, 57, 77);
-	gfx.PutPixel(119 + x, 35 + y, 99, 57, 77);
-	gfx.PutPixel(120 + x, 35 + y, 80, 55, 64);
-	gfx.PutPixel(121 + x, 35 + y, 128, 87, 0);
-	gfx.PutPixel(122 + x, 35 + y, 102, 70, 33);
-	gfx.PutPixel(123 + x, 35 + y, 96, 64, 0);
-	gfx.PutPixel(124 + x, 35 + y, 79, 48, 0);
-	gfx.PutPixel(125 + x, 35 + y, 99, 57, 77);
-	gfx.PutPixel(126 + x, 35 + y, 99, 57, 77);
-	gfx.PutPixel(127 + x, 35 + y, 99, 57, 77);
-	gfx.PutPixel(128 + x, 35 + y, 99, 57, 77);
-	gfx.PutPixel(129 + x, 35 + y, 99, 57, 77);
-	gfx.PutPixel(130 + x, 35 + y, 99, 57, 77);
-	gfx.PutPixel(131 + x, 35 + y, 99, 57, 77);
-	gfx.PutPixel(132 + x, 35 + y, 99, 57, 77);
-	gfx.PutPixel(133 + x, 35 + y, 99, 57, 77);
-	gfx.PutPixel(134 + x, 35 + y, 99, 57, 77);
-	gfx.PutPixel(135 + x, 35 + y, 99, 57, 77);
-	gfx.PutPixel(136 + x, 35 + y, 99, 57, 77);
-	gfx.PutPixel(137 + x, 35 + y, 99, 57, 77);
-	gfx.PutPixel(138 + x, 35 + y, 99, 57, 77);
-	gfx.PutPixel(139 + x, 35 + y, 87, 59, 68);
-	gfx.PutPixel(140 + x, 35 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 36 + y, 192, 199, 223);
-	gfx.PutPixel(104 + x, 36 + y, 176, 183, 223);
-	gfx.PutPixel(105 + x, 36 + y, 159, 159, 208);
-	gfx.PutPixel(106 + x, 36 + y, 112, 119, 112);
-	gfx.PutPixel(107 + x, 36 + y, 63, 63, 63);
-	gfx.PutPixel(108 + x, 36 + y, 127, 63, 96);
-	gfx.PutPixel(109 + x, 36 + y, 128, 71, 111);
-	gfx.PutPixel(110 + x, 36 + y, 112, 63, 96);
-	gfx.PutPixel(111 + x, 36 + y, 127, 120, 95);
-	gfx.PutPixel(112 + x, 36 + y, 143, 143, 32);
-	gfx.PutPixel(113 + x, 36 + y, 160, 160, 0);
-	gfx.PutPixel(114 + x, 36 + y, 143, 136, 0);
-	gfx.PutPixel(115 + x, 36 + y, 127, 120, 95);
-	gfx.PutPixel(116 + x, 36 + y, 96, 103, 0);
-	gfx.PutPixel(117 + x, 36 + y, 112, 63, 96);
-	gfx.PutPixel(118 + x, 36 + y, 112, 63, 96);
-	gfx.PutPixel(119 + x, 36 + y, 112, 63, 96);
-	gfx.PutPixel(120 + x, 36 + y, 112, 63, 96);
-	gfx.PutPixel(121 + x, 36 + y, 95, 56, 64);
-	gfx.PutPixel(122 + x, 36 + y, 128, 87, 0);
-	gfx.PutPixel(123 + x, 36 + y, 111, 77, 35);
-	gfx.PutPixel(124 + x, 36 + y, 96, 64, 0);
-	gfx.PutPixel(125 + x, 36 + y, 79, 48, 0);
-	gfx.PutPixel(126 + x, 36 + y, 111, 63, 95);
-	gfx.PutPixel(127 + x, 36 + y, 112, 63, 96);
-	gfx.PutPixel(128 + x, 36 + y, 115, 61, 89);
-	gfx.PutPixel(129 + x, 36 + y, 112, 63, 96);
-	gfx.PutPixel(130 + x, 36 + y, 115, 61, 89);
-	gfx.PutPixel(131 + x, 36 + y, 112, 63, 96);
-	gfx.PutPixel(132 + x, 36 + y, 115, 61, 89);
-	gfx.PutPixel(133 + x, 36 + y, 112, 63, 96);
-	gfx.PutPixel(134 + x, 36 + y, 115, 61, 89);
-	gfx.PutPixel(135 + x, 36 + y, 112, 63, 96);
-	gfx.PutPixel(136 + x, 36 + y, 115, 61, 89);
-	gfx.PutPixel(137 + x, 36 + y, 112, 63, 96);
-	gfx.PutPixel(138 + x, 36 + y, 115, 61, 89);
-	gfx.PutPixel(139 + x, 36 + y, 111, 63, 95);
-	gfx.PutPixel(140 + x, 36 + y, 99, 57, 77);
-	gfx.PutPixel(141 + x, 36 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 37 + y, 207, 207, 224);
-	gfx.PutPixel(104 + x, 37 + y, 192, 199, 223);
-	gfx.PutPixel(105 + x, 37 + y, 176, 183, 223);
-	gfx.PutPixel(106 + x, 37 + y, 159, 159, 208);
-	gfx.PutPixel(107 + x, 37 + y, 111, 111, 111);
-	gfx.PutPixel(108 + x, 37 + y, 63, 63, 63);
-	gfx.PutPixel(109 + x, 37 + y, 144, 71, 127);
-	gfx.PutPixel(110 + x, 37 + y, 159, 71, 143);
-	gfx.PutPixel(111 + x, 37 + y, 159, 71, 143);
-	gfx.PutPixel(112 + x, 37 + y, 159, 71, 128);
-	gfx.PutPixel(113 + x, 37 + y, 159, 71, 128);
-	gfx.PutPixel(114 + x, 37 + y, 159, 71, 128);
-	gfx.PutPixel(115 + x, 37 + y, 159, 71, 128);
-	gfx.PutPixel(116 + x, 37 + y, 159, 71, 128);
-	gfx.PutPixel(117 + x, 37 + y, 151, 69, 125);
-	gfx.PutPixel(118 + x, 37 + y, 144, 71, 127);
-	gfx.PutPixel(119 + x, 37 + y, 144, 71, 127);
-	gfx.PutPixel(120 + x, 37 + y, 144, 71, 127);
-	gfx.PutPixel(121 + x, 37 + y, 144, 71, 127);
-	gfx.PutPixel(122 + x, 37 + y, 127, 63, 96);
-	gfx.PutPixel(123 + x, 37 + y, 128, 87, 0);
-	gfx.PutPixel(124 + x, 37 + y, 111, 77, 35);
-	gfx.PutPixel(125 + x, 37 + y, 96, 64, 0);
-	gfx.PutPixel(126 + x, 37 + y, 79, 48, 0);
-	gfx.PutPixel(127 + x, 37 + y, 127, 63, 96);
-	gfx.PutPixel(128 + x, 37 + y, 143, 71, 128);
-	gfx.PutPixel(129 + x, 37 + y, 151, 69, 125);
-	gfx.PutPixel(130 + x, 37 + y, 151, 69, 125);
-	gfx.PutPixel(131 + x, 37 + y, 151, 69, 125);
-	gfx.PutPixel(132 + x, 37 + y, 151, 69, 125);
-	gfx.PutPixel(133 + x, 37 + y, 151, 69, 125);
-	gfx.PutPixel(134 + x, 37 + y, 151, 69, 125);
-	gfx.PutPixel(135 + x, 37 + y, 151, 69, 125);
-	gfx.PutPixel(136 + x, 37 + y, 151, 69, 125);
-	gfx.PutPixel(137 + x, 37 + y, 151, 69, 125);
-	gfx.PutPixel(138 + x, 37 + y, 151, 69, 125);
-	gfx.PutPixel(139 + x, 37 + y, 151, 69, 125);
-	gfx.PutPixel(140 + x, 37 + y, 128, 72, 111);
-	gfx.PutPixel(141 + x, 37 + y, 99, 57, 77);
-	gfx.PutPixel(142 + x, 37 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 38 + y, 207, 207, 224);
-	gfx.PutPixel(104 + x, 38 + y, 207, 207, 224);
-	gfx.PutPixel(105 + x, 38 + y, 192, 199, 223);
-	gfx.PutPixel(106 + x, 38 + y, 176, 183, 223);
-	gfx.PutPixel(107 + x, 38 + y, 159, 159, 208);
-	gfx.PutPixel(108 + x, 38 + y, 96, 103, 0);
-	gfx.PutPixel(109 + x, 38 + y, 112, 63, 96);
-	gfx.PutPixel(110 + x, 38 + y, 208, 112, 208);
-	gfx.PutPixel(111 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(112 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(113 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(114 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(115 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(116 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(117 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(118 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(119 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(120 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(121 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(122 + x, 38 + y, 175, 80, 159);
-	gfx.PutPixel(123 + x, 38 + y, 112, 79, 0);
-	gfx.PutPixel(124 + x, 38 + y, 160, 104, 0);
-	gfx.PutPixel(125 + x, 38 + y, 144, 96, 0);
-	gfx.PutPixel(126 + x, 38 + y, 127, 80, 0);
-	gfx.PutPixel(127 + x, 38 + y, 111, 56, 80);
-	gfx.PutPixel(128 + x, 38 + y, 144, 87, 143);
-	gfx.PutPixel(129 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(130 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(131 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(132 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(133 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(134 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(135 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(136 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(137 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(138 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(139 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(140 + x, 38 + y, 207, 79, 191);
-	gfx.PutPixel(141 + x, 38 + y, 175, 79, 159);
-	gfx.PutPixel(142 + x, 38 + y, 111, 63, 95);
-	gfx.PutPixel(143 + x, 38 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 39 + y, 223, 223, 239);
-	gfx.PutPixel(104 + x, 39 + y, 223, 223, 239);
-	gfx.PutPixel(105 + x, 39 + y, 207, 207, 224);
-	gfx.PutPixel(106 + x, 39 + y, 192, 199, 223);
-	gfx.PutPixel(107 + x, 39 + y, 176, 183, 223);
-	gfx.PutPixel(108 + x, 39 + y, 159, 159, 208);
-	gfx.PutPixel(109 + x, 39 + y, 63, 63, 63);
-	gfx.PutPixel(110 + x, 39 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 39 + y, 255, 215, 255);
-	gfx.PutPixel(112 + x, 39 + y, 255, 192, 255);
-	gfx.PutPixel(113 + x, 39 + y, 255, 176, 255);
-	gfx.PutPixel(114 + x, 39 + y, 255, 159, 255);
-	gfx.PutPixel(115 + x, 39 + y, 255, 159, 255);
-	gfx.PutPixel(116 + x, 39 + y, 255, 143, 255);
-	gfx.PutPixel(117 + x, 39 + y, 255, 143, 255);
-	gfx.PutPixel(118 + x, 39 + y, 255, 143, 255);
-	gfx.PutPixel(119 + x, 39 + y, 255, 143, 255);
-	gfx.PutPixel(120 + x, 39 + y, 255, 143, 255);
-	gfx.PutPixel(121 + x, 39 + y, 255, 143, 255);
-	gfx.PutPixel(122 + x, 39 + y, 239, 136, 239);
-	gfx.PutPixel(123 + x, 39 + y, 175, 87, 160);
-	gfx.PutPixel(124 + x, 39 + y, 127, 111, 80);
-	gfx.PutPixel(125 + x, 39 + y, 219, 189, 123);
-	gfx.PutPixel(126 + x, 39 + y, 169, 127, 41);
-	gfx.PutPixel(127 + x, 39 + y, 127, 87, 31);
-	gfx.PutPixel(128 + x, 39 + y, 111, 72, 0);
-	gfx.PutPixel(129 + x, 39 + y, 239, 136, 239);
-	gfx.PutPixel(130 + x, 39 + y, 239, 136, 239);
-	gfx.PutPixel(131 + x, 39 + y, 255, 143, 255);
-	gfx.PutPixel(132 + x, 39 + y, 255, 143, 255);
-	gfx.PutPixel(133 + x, 39 + y, 255, 143, 255);
-	gfx.PutPixel(134 + x, 39 + y, 255, 143, 255);
-	gfx.PutPixel(135 + x, 39 + y, 255, 143, 255);
-	gfx.PutPixel(136 + x, 39 + y, 255, 143, 255);
-	gfx.PutPixel(137 + x, 39 + y, 255, 143, 255);
-	gfx.PutPixel(138 + x, 39 + y, 255, 143, 255);
-	gfx.PutPixel(139 + x, 39 + y, 255, 143, 255);
-	gfx.PutPixel(140 + x, 39 + y, 255, 143, 255);
-	gfx.PutPixel(141 + x, 39 + y, 239, 136, 239);
-	gfx.PutPixel(142 + x, 39 + y, 144, 103, 143);
-	gfx.PutPixel(143 + x, 39 + y, 48, 48, 48);
-	gfx.PutPixel(102 + x, 40 + y, 63, 63, 63);
-	gfx.PutPixel(103 + x, 40 + y, 223, 223, 239);
-	gfx.PutPixel(104 + x, 40 + y, 224, 231, 224);
-	gfx.PutPixel(105 + x, 40 + y, 223, 223, 239);
-	gfx.PutPixel(106 + x, 40 + y, 207, 207, 224);
-	gfx.PutPixel(107 + x, 40 + y, 192, 199, 223);
-	gfx.PutPixel(108 + x, 40 + y, 176, 183, 223);
-	gfx.PutPixel(109 + x, 40 + y, 63, 63, 63);
-	gfx.PutPixel(110 + x, 40 + y, 255, 159, 255);
-	gfx.PutPixel(111 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(112 + x, 40 + y, 176, 71, 160);
-	gfx.PutPixel(113 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(114 + x, 40 + y, 159, 71, 143);
-	gfx.PutPixel(115 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(116 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(117 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(118 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(119 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(120 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(121 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(122 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(123 + x, 40 + y, 191, 95, 175);
-	gfx.PutPixel(124 + x, 40 + y, 95, 87, 79);
-	gfx.PutPixel(125 + x, 40 + y, 181, 142, 62);
-	gfx.PutPixel(126 + x, 40 + y, 127, 80, 0);
-	gfx.PutPixel(127 + x, 40 + y, 127, 80, 0);
-	gfx.PutPixel(128 + x, 40 + y, 48, 39, 0);
-	gfx.PutPixel(129 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(130 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(131 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(132 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(133 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(134 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(135 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(136 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(137 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(138 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(139 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(140 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(141 + x, 40 + y, 207, 95, 192);
-	gfx.PutPixel(142 + x, 40 + y, 175, 79, 144);
-	gfx.PutPixel(143 + x, 40 + y, 48, 48, 48);
-	gfx.PutPixel(102 + x, 41 + y, 112, 119, 112);
-	gfx.PutPixel(103 + x, 41 + y, 63, 63, 63);
-	gfx.PutPixel(104 + x, 41 + y, 223, 223, 239);
-	gfx.PutPixel(105 + x, 41 + y, 224, 231, 224);
-	gfx.PutPixel(106 + x, 41 + y, 223, 223, 239);
-	gfx.PutPixel(107 + x, 41 + y, 207, 207, 224);
-	gfx.PutPixel(108 + x, 41 + y, 192, 199, 223);
-	gfx.PutPixel(109 + x, 41 + y, 63, 63, 63);
-	gfx.PutPixel(110 + x, 41 + y, 208, 112, 208);
-	gfx.PutPixel(111 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(112 + x, 41 + y, 240, 240, 0);
-	gfx.PutPixel(113 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(114 + x, 41 + y, 224, 224, 47);
-	gfx.PutPixel(115 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(116 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(117 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(118 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(119 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(120 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(121 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(122 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(123 + x, 41 + y, 160, 79, 144);
-	gfx.PutPixel(124 + x, 41 + y, 95, 87, 79);
-	gfx.PutPixel(125 + x, 41 + y, 143, 95, 0);
-	gfx.PutPixel(126 + x, 41 + y, 112, 72, 0);
-	gfx.PutPixel(127 + x, 41 + y, 80, 48, 0);
-	gfx.PutPixel(128 + x, 41 + y, 48, 39, 0);
-	gfx.PutPixel(129 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(130 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(131 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(132 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(133 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(134 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(135 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(136 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(137 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(138 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(139 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(140 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(141 + x, 41 + y, 176, 71, 160);
-	gfx.PutPixel(142 + x, 41 + y, 159, 72, 128);
-	gfx.PutPixel(143 + x, 41 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 42 + y, 112, 119, 112);
-	gfx.PutPixel(104 + x, 42 + y, 63, 63, 63);
-	gfx.PutPixel(105 + x, 42 + y, 223, 223, 239);
-	gfx.PutPixel(106 + x, 42 + y, 224, 231, 224);
-	gfx.PutPixel(107 + x, 42 + y, 223, 223, 239);
-	gfx.PutPixel(108 + x, 42 + y, 207, 207, 224);
-	gfx.PutPixel(109 + x, 42 + y, 63, 63, 63);
-	gfx.PutPixel(110 + x, 42 + y, 175, 80, 160);
-	gfx.PutPixel(111 + x, 42 + y, 159, 71, 143);
-	gfx.PutPixel(112 + x, 42 + y, 208, 215, 63);
-	gfx.PutPixel(113 + x, 42 + y, 159, 71, 143);
-	gfx.PutPixel(114 + x, 42 + y, 223, 223, 0);
-	gfx.PutPixel(115 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(116 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(117 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(118 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(119 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(120 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(121 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(122 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(123 + x, 42 + y, 143, 72, 127);
-	gfx.PutPixel(124 + x, 42 + y, 95, 87, 79);
-	gfx.PutPixel(125 + x, 42 + y, 112, 72, 0);
-	gfx.PutPixel(126 + x, 42 + y, 80, 48, 0);
-	gfx.PutPixel(127 + x, 42 + y, 80, 48, 0);
-	gfx.PutPixel(128 + x, 42 + y, 48, 39, 0);
-	gfx.PutPixel(129 + x, 42 + y, 143, 72, 127);
-	gfx.PutPixel(130 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(131 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(132 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(133 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(134 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(135 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(136 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(137 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(138 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(139 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(140 + x, 42 + y, 149, 71, 127);
-	gfx.PutPixel(141 + x, 42 + y, 143, 64, 128);
-	gfx.PutPixel(142 + x, 42 + y, 143, 72, 112);
-	gfx.PutPixel(143 + x, 42 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 43 + y, 159, 159, 208);
-	gfx.PutPixel(104 + x, 43 + y, 112, 119, 112);
-	gfx.PutPixel(105 + x, 43 + y, 63, 63, 63);
-	gfx.PutPixel(106 + x, 43 + y, 208, 215, 239);
-	gfx.PutPixel(107 + x, 43 + y, 224, 231, 224);
-	gfx.PutPixel(108 + x, 43 + y, 223, 223, 239);
-	gfx.PutPixel(109 + x, 43 + y, 63, 63, 63);
-	gfx.PutPixel(110 + x, 43 + y, 159, 71, 143);
-	gfx.PutPixel(111 + x, 43 + y, 128, 71, 111);
-	gfx.PutPixel(112 + x, 43 + y, 176, 183, 48);
-	gfx.PutPixel(113 + x, 43 + y, 128, 71, 111);
-	gfx.PutPixel(114 + x, 43 + y, 176, 183, 48);
-	gfx.PutPixel(115 + x, 43 + y, 128, 71, 111);
-	gfx.PutPixel(116 + x, 43 + y, 127, 65, 111);
-	gfx.PutPixel(117 + x, 43 + y, 128, 71, 111);
-	gfx.PutPixel(118 + x, 43 + y, 127, 65, 111);
-	gfx.PutPixel(119 + x, 43 + y, 128, 71, 111);
-	gfx.PutPixel(120 + x, 43 + y, 127, 65, 111);
-	gfx.PutPixel(121 + x, 43 + y, 128, 71, 111);
-	gfx.PutPixel(122 + x, 43 + y, 127, 65, 111);
-	gfx.PutPixel(123 + x, 43 + y, 111, 71, 80);
-	gfx.PutPixel(124 + x, 43 + y, 95, 87, 79);
-	gfx.PutPixel(125 + x, 43 + y, 48, 48, 48);
-	gfx.PutPixel(126 + x, 43 + y, 80, 80, 0);
-	gfx.PutPixel(127 + x, 43 + y, 48, 48, 48);
-	gfx.PutPixel(128 + x, 43 + y, 48, 39, 0);
-	gfx.PutPixel(129 + x, 43 + y, 111, 71, 80);
-	gfx.PutPixel(130 + x, 43 + y, 127, 65, 111);
-	gfx.PutPixel(131 + x, 43 + y, 128, 71, 111);
-	gfx.PutPixel(132 + x, 43 + y, 127, 65, 111);
-	gfx.PutPixel(133 + x, 43 + y, 128, 71, 111);
-	gfx.PutPixel(134 + x, 43 + y, 127, 65, 111);
-	gfx.PutPixel(135 + x, 43 + y, 128, 71, 111);
-	gfx.PutPixel(136 + x, 43 + y, 127, 65, 111);
-	gfx.PutPixel(137 + x, 43 + y, 128, 71, 111);
-	gfx.PutPixel(138 + x, 43 + y, 127, 65, 111);
-	gfx.PutPixel(139 + x, 43 + y, 128, 71, 111);
-	gfx.PutPixel(140 + x, 43 + y, 127, 65, 111);
-	gfx.PutPixel(141 + x, 43 + y, 127, 65, 111);
-	gfx.PutPixel(142 + x, 43 + y, 120, 63, 104);
-	gfx.PutPixel(143 + x, 43 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 44 + y, 176, 183, 223);
-	gfx.PutPixel(104 + x, 44 + y, 159, 159, 208);
-	gfx.PutPixel(105 + x, 44 + y, 112, 119, 112);
-	gfx.PutPixel(106 + x, 44 + y, 63, 63, 63);
-	gfx.PutPixel(107 + x, 44 + y, 208, 215, 239);
-	gfx.PutPixel(108 + x, 44 + y, 224, 231, 224);
-	gfx.PutPixel(109 + x, 44 + y, 63, 63, 63);
-	gfx.PutPixel(110 + x, 44 + y, 111, 71, 80);
-	gfx.PutPixel(111 + x, 44 + y, 111, 71, 80);
-	gfx.PutPixel(112 + x, 44 + y, 128, 135, 47);
-	gfx.PutPixel(113 + x, 44 + y, 111, 63, 95);
-	gfx.PutPixel(114 + x, 44 + y, 128, 135, 47);
-	gfx.PutPixel(115 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(116 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(117 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(118 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(119 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(120 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(121 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(122 + x, 44 + y, 96, 64, 80);
-	gfx.PutPixel(123 + x, 44 + y, 79, 72, 79);
-	gfx.PutPixel(124 + x, 44 + y, 79, 72, 79);
-	gfx.PutPixel(125 + x, 44 + y, 79, 72, 79);
-	gfx.PutPixel(126 + x, 44 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 44 + y, 128, 135, 128);
-	gfx.PutPixel(128 + x, 44 + y, 63, 63, 63);
-	gfx.PutPixel(129 + x, 44 + y, 79, 72, 79);
-	gfx.PutPixel(130 + x, 44 + y, 80, 63, 63);
-	gfx.PutPixel(131 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(132 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(133 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(134 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(135 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(136 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(137 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(138 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(139 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(140 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(141 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(142 + x, 44 + y, 107, 61, 91);
-	gfx.PutPixel(143 + x, 44 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 45 + y, 192, 199, 223);
-	gfx.PutPixel(104 + x, 45 + y, 176, 183, 223);
-	gfx.PutPixel(105 + x, 45 + y, 159, 159, 208);
-	gfx.PutPixel(106 + x, 45 + y, 112, 119, 112);
-	gfx.PutPixel(107 + x, 45 + y, 63, 63, 63);
-	gfx.PutPixel(108 + x, 45 + y, 208, 215, 239);
-	gfx.PutPixel(109 + x, 45 + y, 63, 63, 63);
-	gfx.PutPixel(110 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(111 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(112 + x, 45 + y, 79, 72, 79);
-	gfx.PutPixel(113 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(114 + x, 45 + y, 79, 72, 79);
-	gfx.PutPixel(115 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(116 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(117 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(118 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(119 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(120 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(121 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(122 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(123 + x, 45 + y, 79, 72, 79);
-	gfx.PutPixel(124 + x, 45 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 45 + y, 240, 240, 240);
-	gfx.PutPixel(126 + x, 45 + y, 175, 168, 175);
-	gfx.PutPixel(127 + x, 45 + y, 144, 144, 144);
-	gfx.PutPixel(128 + x, 45 + y, 207, 207, 207);
-	gfx.PutPixel(129 + x, 45 + y, 144, 144, 144);
-	gfx.PutPixel(130 + x, 45 + y, 32, 39, 32);
-	gfx.PutPixel(131 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(132 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(133 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(134 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(135 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(136 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(137 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(138 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(139 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(140 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(141 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(142 + x, 45 + y, 80, 55, 64);
-	gfx.PutPixel(143 + x, 45 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 46 + y, 207, 207, 224);
-	gfx.PutPixel(104 + x, 46 + y, 192, 199, 223);
-	gfx.PutPixel(105 + x, 46 + y, 176, 183, 223);
-	gfx.PutPixel(106 + x, 46 + y, 159, 159, 208);
-	gfx.PutPixel(107 + x, 46 + y, 112, 119, 112);
-	gfx.PutPixel(108 + x, 46 + y, 63, 63, 63);
-	gfx.PutPixel(109 + x, 46 + y, 15, 15, 15);
-	gfx.PutPixel(123 + x, 46 + y, 79, 72, 79);
-	gfx.PutPixel(124 + x, 46 + y, 192, 192, 192);
-	gfx.PutPixel(125 + x, 46 + y, 15, 15, 15);
-	gfx.PutPixel(126 + x, 46 + y, 111, 111, 111);
-	gfx.PutPixel(127 + x, 46 + y, 111, 111, 111);
-	gfx.PutPixel(128 + x, 46 + y, 15, 15, 15);
-	gfx.PutPixel(129 + x, 46 + y, 111, 111, 111);
-	gfx.PutPixel(130 + x, 46 + y, 32, 39, 32);
-	gfx.PutPixel(103 + x, 47 + y, 207, 207, 224);
-	gfx.PutPixel(104 + x, 47 + y, 207, 207, 224);
-	gfx.PutPixel(105 + x, 47 + y, 192, 199, 223);
-	gfx.PutPixel(106 + x, 47 + y, 176, 183, 223);
-	gfx.PutPixel(107 + x, 47 + y, 159, 159, 208);
-	gfx.PutPixel(108 + x, 47 + y, 96, 103, 0);
-	gfx.PutPixel(109 + x, 47 + y, 63, 63, 63);
-	gfx.PutPixel(110 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(111 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(112 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(113 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(114 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(115 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(116 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(117 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(118 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(119 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(120 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(121 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(122 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(123 + x, 47 + y, 79, 72, 79);
-	gfx.PutPixel(124 + x, 47 + y, 192, 192, 192);
-	gfx.PutPixel(125 + x, 47 + y, 16, 15, 0);
-	gfx.PutPixel(126 + x, 47 + y, 96, 96, 96);
-	gfx.PutPixel(127 + x, 47 + y, 63, 63, 63);
-	gfx.PutPixel(128 + x, 47 + y, 16, 15, 0);
-	gfx.PutPixel(129 + x, 47 + y, 111, 111, 111);
-	gfx.PutPixel(130 + x, 47 + y, 32, 39, 32);
-	gfx.PutPixel(131 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(132 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(133 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(134 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(135 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(136 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(137 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(138 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(139 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(140 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(141 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(142 + x, 47 + y, 0, 7, 95);
-	gfx.PutPixel(143 + x, 47 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 48 + y, 223, 223, 239);
-	gfx.PutPixel(104 + x, 48 + y, 223, 223, 239);
-	gfx.PutPixel(105 + x, 48 + y, 207, 207, 224);
-	gfx.PutPixel(106 + x, 48 + y, 192, 199, 223);
-	gfx.PutPixel(107 + x, 48 + y, 176, 183, 223);
-	gfx.PutPixel(108 + x, 48 + y, 159, 159, 208);
-	gfx.PutPixel(109 + x, 48 + y, 63, 63, 63);
-	gfx.PutPixel(110 + x, 48 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 48 + y, 144, 184, 255);
-	gfx.PutPixel(112 + x, 48 + y, 111, 159, 255);
-	gfx.PutPixel(113 + x, 48 + y, 63, 128, 255);
-	gfx.PutPixel(114 + x, 48 + y, 47, 112, 255);
-	gfx.PutPixel(115 + x, 48 + y, 0, 88, 255);
-	gfx.PutPixel(116 + x, 48 + y, 0, 88, 255);
-	gfx.PutPixel(117 + x, 48 + y, 0, 88, 255);
-	gfx.PutPixel(118 + x, 48 + y, 0, 88, 255);
-	gfx.PutPixel(119 + x, 48 + y, 0, 88, 255);
-	gfx.PutPixel(120 + x, 48 + y, 0, 88, 255);
-	gfx.PutPixel(121 + x, 48 + y, 32, 56, 240);
-	gfx.PutPixel(122 + x, 48 + y, 32, 40, 208);
-	gfx.PutPixel(123 + x, 48 + y, 79, 72, 79);
-	gfx.PutPixel(124 + x, 48 + y, 192, 192, 192);
-	gfx.PutPixel(125 + x, 48 + y, 32, 24, 0);
-	gfx.PutPixel(126 + x, 48 + y, 79, 72, 79);
-	gfx.PutPixel(127 + x, 48 + y, 63, 63, 63);
-	gfx.PutPixel(128 + x, 48 + y, 32, 24, 0);
-	gfx.PutPixel(129 + x, 48 + y, 111, 111, 111);
-	gfx.PutPixel(130 + x, 48 + y, 32, 39, 32);
-	gfx.PutPixel(131 + x, 48 + y, 32, 40, 208);
-	gfx.PutPixel(132 + x, 48 + y, 0, 88, 255);
-	gfx.PutPixel(133 + x, 48 + y, 0, 88, 255);
-	gfx.PutPixel(134 + x, 48 + y, 0, 88, 255);
-	gfx.PutPixel(135 + x, 48 + y, 0, 88, 255);
-	gfx.PutPixel(136 + x, 48 + y, 0, 88, 255);
-	gfx.PutPixel(137 + x, 48 + y, 0, 88, 255);
-	gfx.PutPixel(138 + x, 48 + y, 0, 88, 255);
-	gfx.PutPixel(139 + x, 48 + y, 0, 88, 255);
-	gfx.PutPixel(140 + x, 48 + y, 0, 88, 255);
-	gfx.PutPixel(141 + x, 48 + y, 0, 88, 255);
-	gfx.PutPixel(142 + x, 48 + y, 48, 55, 255);
-	gfx.PutPixel(143 + x, 48 + y, 48, 48, 48);
-	gfx.PutPixel(102 + x, 49 + y, 63, 63, 63);
-	gfx.PutPixel(103 + x, 49 + y, 223, 223, 239);
-	gfx.PutPixel(104 + x, 49 + y, 224, 231, 224);
-	gfx.PutPixel(105 + x, 49 + y, 223, 223, 239);
-	gfx.PutPixel(106 + x, 49 + y, 207, 207, 224);
-	gfx.PutPixel(107 + x, 49 + y, 192, 199, 223);
-	gfx.PutPixel(108 + x, 49 + y, 176, 183, 223);
-	gfx.PutPixel(109 + x, 49 + y, 63, 63, 63);
-	gfx.PutPixel(110 + x, 49 + y, 111, 159, 255);
-	gfx.PutPixel(111 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(112 + x, 49 + y, 32, 39, 192);
-	gfx.PutPixel(113 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(114 + x, 49 + y, 31, 24, 160);
-	gfx.PutPixel(115 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(116 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(117 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(118 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(119 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(120 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(121 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(122 + x, 49 + y, 32, 40, 208);
-	gfx.PutPixel(123 + x, 49 + y, 79, 72, 79);
-	gfx.PutPixel(124 + x, 49 + y, 223, 216, 223);
-	gfx.PutPixel(125 + x, 49 + y, 63, 39, 0);
-	gfx.PutPixel(126 + x, 49 + y, 15, 15, 15);
-	gfx.PutPixel(127 + x, 49 + y, 15, 15, 15);
-	gfx.PutPixel(128 + x, 49 + y, 63, 39, 0);
-	gfx.PutPixel(129 + x, 49 + y, 111, 111, 111);
-	gfx.PutPixel(130 + x, 49 + y, 32, 39, 32);
-	gfx.PutPixel(131 + x, 49 + y, 32, 40, 208);
-	gfx.PutPixel(132 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(133 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(134 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(135 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(136 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(137 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(138 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(139 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(140 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(141 + x, 49 + y, 32, 56, 240);
-	gfx.PutPixel(142 + x, 49 + y, 48, 48, 239);
-	gfx.PutPixel(143 + x, 49 + y, 48, 48, 48);
-	gfx.PutPixel(102 + x, 50 + y, 127, 127, 127);
-	gfx.PutPixel(103 + x, 50 + y, 63, 63, 63);
-	gfx.PutPixel(104 + x, 50 + y, 223, 223, 239);
-	gfx.PutPixel(105 + x, 50 + y, 224, 231, 224);
-	gfx.PutPixel(106 + x, 50 + y, 223, 223, 239);
-	gfx.PutPixel(107 + x, 50 + y, 207, 207, 224);
-	gfx.PutPixel(108 + x, 50 + y, 192, 199, 223);
-	gfx.PutPixel(109 + x, 50 + y, 63, 63, 63);
-	gfx.PutPixel(110 + x, 50 + y, 0, 88, 255);
-	gfx.PutPixel(111 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(112 + x, 50 + y, 240, 240, 0);
-	gfx.PutPixel(113 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(114 + x, 50 + y, 224, 224, 47);
-	gfx.PutPixel(115 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(116 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(117 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(118 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(119 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(120 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(121 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(122 + x, 50 + y, 31, 39, 192);
-	gfx.PutPixel(123 + x, 50 + y, 79, 72, 79);
-	gfx.PutPixel(124 + x, 50 + y, 144, 144, 144);
-	gfx.PutPixel(125 + x, 50 + y, 80, 80, 0);
-	gfx.PutPixel(126 + x, 50 + y, 63, 63, 63);
-	gfx.PutPixel(127 + x, 50 + y, 63, 63, 63);
-	gfx.PutPixel(128 + x, 50 + y, 80, 80, 0);
-	gfx.PutPixel(129 + x, 50 + y, 96, 96, 96);
-	gfx.PutPixel(130 + x, 50 + y, 32, 39, 32);
-	gfx.PutPixel(131 + x, 50 + y, 31, 39, 192);
-	gfx.PutPixel(132 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(133 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(134 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(135 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(136 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(137 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(138 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(139 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(140 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(141 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(142 + x, 50 + y, 32, 40, 208);
-	gfx.PutPixel(143 + x, 50 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 51 + y, 127, 127, 127);
-	gfx.PutPixel(104 + x, 51 + y, 63, 63, 63);
-	gfx.PutPixel(105 + x, 51 + y, 223, 223, 239);
-	gfx.PutPixel(106 + x, 51 + y, 224, 231, 224);
-	gfx.PutPixel(107 + x, 51 + y, 223, 223, 239);
-	gfx.PutPixel(108 + x, 51 + y, 207, 207, 224);
-	gfx.PutPixel(109 + x, 51 + y, 63, 63, 63);
-	gfx.PutPixel(110 + x, 51 + y, 32, 40, 208);
-	gfx.PutPixel(111 + x, 51 + y, 32, 39, 192);
-	gfx.PutPixel(112 + x, 51 + y, 208, 215, 63);
-	gfx.PutPixel(113 + x, 51 + y, 32, 39, 192);
-	gfx.PutPixel(114 + x, 51 + y, 223, 223, 0);
-	gfx.PutPixel(115 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(116 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(117 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(118 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(119 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(120 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(121 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(122 + x, 51 + y, 31, 24, 160);
-	gfx.PutPixel(123 + x, 51 + y, 63, 63, 63);
-	gfx.PutPixel(124 + x, 51 + y, 63, 63, 63);
-	gfx.PutPixel(125 + x, 51 + y, 32, 39, 32);
-	gfx.PutPixel(126 + x, 51 + y, 32, 39, 32);
-	gfx.PutPixel(127 + x, 51 + y, 32, 39, 32);
-	gfx.PutPixel(128 + x, 51 + y, 32, 39, 32);
-	gfx.PutPixel(129 + x, 51 + y, 32, 39, 32);
-	gfx.PutPixel(130 + x, 51 + y, 0, 7, 95);
-	gfx.PutPixel(131 + x, 51 + y, 31, 24, 160);
-	gfx.PutPixel(132 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(133 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(134 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(135 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(136 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(137 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(138 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(139 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(140 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(141 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(142 + x, 51 + y, 31, 32, 191);
-	gfx.PutPixel(143 + x, 51 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 52 + y, 159, 159, 208);
-	gfx.PutPixel(104 + x, 52 + y, 127, 127, 127);
-	gfx.PutPixel(105 + x, 52 + y, 63, 63, 63);
-	gfx.PutPixel(106 + x, 52 + y, 208, 215, 239);
-	gfx.PutPixel(107 + x, 52 + y, 224, 231, 224);
-	gfx.PutPixel(108 + x, 52 + y, 223, 223, 239);
-	gfx.PutPixel(109 + x, 52 + y, 63, 63, 63);
-	gfx.PutPixel(110 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(111 + x, 52 + y, 32, 39, 192);
-	gfx.PutPixel(112 + x, 52 + y, 176, 183, 48);
-	gfx.PutPixel(113 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(114 + x, 52 + y, 176, 183, 48);
-	gfx.PutPixel(115 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(116 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(117 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(118 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(119 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(120 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(121 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(122 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(123 + x, 52 + y, 31, 23, 144);
-	gfx.PutPixel(124 + x, 52 + y, 15, 15, 127);
-	gfx.PutPixel(125 + x, 52 + y, 182, 124, 20);
-	gfx.PutPixel(126 + x, 52 + y, 175, 112, 0);
-	gfx.PutPixel(127 + x, 52 + y, 143, 95, 0);
-	gfx.PutPixel(128 + x, 52 + y, 127, 87, 31);
-	gfx.PutPixel(129 + x, 52 + y, 15, 15, 127);
-	gfx.PutPixel(130 + x, 52 + y, 31, 23, 144);
-	gfx.PutPixel(131 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(132 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(133 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(134 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(135 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(136 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(137 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(138 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(139 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(140 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(141 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(142 + x, 52 + y, 31, 24, 160);
-	gfx.PutPixel(143 + x, 52 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 53 + y, 176, 183, 223);
-	gfx.PutPixel(104 + x, 53 + y, 159, 159, 208);
-	gfx.PutPixel(105 + x, 53 + y, 127, 127, 127);
-	gfx.PutPixel(106 + x, 53 + y, 63, 63, 63);
-	gfx.PutPixel(107 + x, 53 + y, 208, 215, 239);
-	gfx.PutPixel(108 + x, 53 + y, 224, 231, 224);
-	gfx.PutPixel(109 + x, 53 + y, 63, 63, 63);
-	gfx.PutPixel(110 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(111 + x, 53 + y, 31, 24, 160);
-	gfx.PutPixel(112 + x, 53 + y, 128, 135, 47);
-	gfx.PutPixel(113 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(114 + x, 53 + y, 128, 135, 47);
-	gfx.PutPixel(115 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(116 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(117 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(118 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(119 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(120 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(121 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(122 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(123 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(124 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(125 + x, 53 + y, 95, 63, 0);
-	gfx.PutPixel(126 + x, 53 + y, 79, 48, 0);
-	gfx.PutPixel(127 + x, 53 + y, 79, 48, 0);
-	gfx.PutPixel(128 + x, 53 + y, 80, 48, 0);
-	gfx.PutPixel(129 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(130 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(131 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(132 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(133 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(134 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(135 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(136 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(137 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(138 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(139 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(140 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(141 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(142 + x, 53 + y, 15, 15, 127);
-	gfx.PutPixel(143 + x, 53 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 54 + y, 192, 199, 223);
-	gfx.PutPixel(104 + x, 54 + y, 176, 183, 223);
-	gfx.PutPixel(105 + x, 54 + y, 159, 159, 208);
-	gfx.PutPixel(106 + x, 54 + y, 127, 127, 127);
-	gfx.PutPixel(107 + x, 54 + y, 63, 63, 63);
-	gfx.PutPixel(108 + x, 54 + y, 208, 215, 239);
-	gfx.PutPixel(109 + x, 54 + y, 48, 48, 48);
-	gfx.PutPixel(110 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(111 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(112 + x, 54 + y, 79, 72, 79);
-	gfx.PutPixel(113 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(114 + x, 54 + y, 79, 72, 79);
-	gfx.PutPixel(115 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(116 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(117 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(118 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(119 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(120 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(121 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(122 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(123 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(124 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(125 + x, 54 + y, 143, 95, 0);
-	gfx.PutPixel(126 + x, 54 + y, 96, 63, 0);
-	gfx.PutPixel(127 + x, 54 + y, 96, 63, 0);
-	gfx.PutPixel(128 + x, 54 + y, 76, 46, 40);
-	gfx.PutPixel(129 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(130 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(131 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(132 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(133 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(134 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(135 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(136 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(137 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(138 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(139 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(140 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(141 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(142 + x, 54 + y, 0, 7, 95);
-	gfx.PutPixel(143 + x, 54 + y, 48, 48, 48);
-	gfx.PutPixel(103 + x, 55 + y, 207, 207, 224);
-	gfx.PutPixel(104 + x, 55 + y, 192, 199, 223);
-	gfx.PutPixel(105 + x, 55 + y, 176, 183, 223);
-	gfx.PutPixel(106 + x, 55 + y, 159, 159, 208);
-	gfx.PutPixel(107 + x, 55 + y, 127, 127, 127);
-	gfx.PutPixel(108 + x, 55 + y, 63, 63, 63);
-	gfx.PutPixel(109 + x, 55 + y, 15, 15, 15);
-	gfx.PutPixel(125 + x, 55 + y, 175, 112, 0);
-	gfx.PutPixel(126 + x, 55 + y, 143, 95, 0);
-	gfx.PutPixel(127 + x, 55 + y, 111, 72, 0);
-	gfx.PutPixel(128 + x, 55 + y, 87, 50, 55);
-	gfx.PutPixel(103 + x, 56 + y, 223, 223, 239);
-	gfx.PutPixel(104 + x, 56 + y, 211, 211, 227);
-	gfx.PutPixel(105 + x, 56 + y, 192, 199, 223);
-	gfx.PutPixel(106 + x, 56 + y, 176, 183, 223);
-	gfx.PutPixel(107 + x, 56 + y, 159, 159, 208);
-	gfx.PutPixel(108 + x, 56 + y, 96, 103, 0);
-	gfx.PutPixel(109 + x, 56 + y, 47, 63, 31);
-	gfx.PutPixel(110 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(111 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(112 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(113 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(114 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(115 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(116 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(117 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(118 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(119 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(120 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(121 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(122 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(123 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(124 + x, 56 + y, 47, 63, 31);
-	gfx.PutPixel(125 + x, 56 + y, 175, 127, 48);
-	gfx.PutPixel(126 + x, 56 + y, 159, 103, 0);
-	gfx.PutPixel(127 + x, 56 + y, 129, 91, 38);
-	gfx.PutPixel(128 + x, 56 + y, 87, 50, 55);
-	gfx.PutPixel(129 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(130 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(131 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(132 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(133 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(134 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(135 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(136 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(137 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(138 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(139 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(140 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(141 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(142 + x, 56 + y, 11, 76, 43);
-	gfx.PutPixel(143 + x, 56 + y, 47, 63, 31);
-	gfx.PutPixel(102 + x, 57 + y, 127, 127, 127);
-	gfx.PutPixel(103 + x, 57 + y, 223, 223, 239);
-	gfx.PutPixel(104 + x, 57 + y, 223, 223, 239);
-	gfx.PutPixel(105 + x, 57 + y, 211, 211, 227);
-	gfx.PutPixel(106 + x, 57 + y, 192, 199, 223);
-	gfx.PutPixel(107 + x, 57 + y, 176, 183, 223);
-	gfx.PutPixel(108 + x, 57 + y, 159, 159, 208);
-	gfx.PutPixel(109 + x, 57 + y, 47, 63, 31);
-	gfx.PutPixel(110 + x, 57 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 57 + y, 176, 255, 192);
-	gfx.PutPixel(112 + x, 57 + y, 143, 255, 111);
-	gfx.PutPixel(113 + x, 57 + y, 0, 255, 0);
-	gfx.PutPixel(114 + x, 57 + y, 0, 231, 0);
-	gfx.PutPixel(115 + x, 57 + y, 0, 231, 0);
-	gfx.PutPixel(116 + x, 57 + y, 0, 231, 0);
-	gfx.PutPixel(117 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(118 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(119 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(120 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(121 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(122 + x, 57 + y, 63, 216, 48);
-	gfx.PutPixel(123 + x, 57 + y, 48, 199, 47);
-	gfx.PutPixel(124 + x, 57 + y, 16, 175, 15);
-	gfx.PutPixel(125 + x, 57 + y, 175, 112, 0);
-	gfx.PutPixel(126 + x, 57 + y, 160, 104, 0);
-	gfx.PutPixel(127 + x, 57 + y, 143, 95, 0);
-	gfx.PutPixel(128 + x, 57 + y, 79, 48, 0);
-	gfx.PutPixel(129 + x, 57 + y, 16, 175, 15);
-	gfx.PutPixel(130 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(131 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(132 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(133 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(134 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(135 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(136 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(137 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(138 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(139 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(140 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(141 + x, 57 + y, 0, 223, 0);
-	gfx.PutPixel(142 + x, 57 + y, 0, 184, 0);
-	gfx.PutPixel(143 + x, 57 + y, 47, 63, 31);
-	gfx.PutPixel(102 + x, 58 + y, 47, 63, 31);
-	gfx.PutPixel(103 + x, 58 + y, 127, 127, 127);
-	gfx.PutPixel(104 + x, 58 + y, 224, 231, 224);
-	gfx.PutPixel(105 + x, 58 + y, 223, 223, 239);
-	gfx.PutPixel(106 + x, 58 + y, 211, 211, 227);
-	gfx.PutPixel(107 + x, 58 + y, 192, 199, 223);
-	gfx.PutPixel(108 + x, 58 + y, 176, 183, 223);
-	gfx.PutPixel(109 + x, 58 + y, 47, 63, 31);
-	gfx.PutPixel(110 + x, 58 + y, 0, 231, 0);
-	gfx.PutPixel(111 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(112 + x, 58 + y, 0, 152, 112);
-	gfx.PutPixel(113 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(114 + x, 58 + y, 0, 152, 112);
-	gfx.PutPixel(115 + x, 58 + y, 0, 184, 127);
-	gfx.PutPixel(116 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(117 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(118 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(119 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(120 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(121 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(122 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(123 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(124 + x, 58 + y, 16, 159, 15);
-	gfx.PutPixel(125 + x, 58 + y, 175, 112, 0);
-	gfx.PutPixel(126 + x, 58 + y, 143, 95, 0);
-	gfx.PutPixel(127 + x, 58 + y, 128, 87, 0);
-	gfx.PutPixel(128 + x, 58 + y, 79, 48, 0);
-	gfx.PutPixel(129 + x, 58 + y, 16, 159, 15);
-	gfx.PutPixel(130 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(131 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(132 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(133 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(134 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(135 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(136 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(137 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(138 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(139 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(140 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(141 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(142 + x, 58 + y, 15, 192, 0);
-	gfx.PutPixel(143 + x, 58 + y, 47, 63, 31);
-	gfx.PutPixel(103 + x, 59 + y, 47, 63, 31);
-	gfx.PutPixel(104 + x, 59 + y, 128, 135, 128);
-	gfx.PutPixel(105 + x, 59 + y, 224, 231, 224);
-	gfx.PutPixel(106 + x, 59 + y, 223, 223, 239);
-	gfx.PutPixel(107 + x, 59 + y, 207, 207, 224);
-	gfx.PutPixel(108 + x, 59 + y, 192, 199, 223);
-	gfx.PutPixel(109 + x, 59 + y, 47, 63, 31);
-	gfx.PutPixel(110 + x, 59 + y, 0, 184, 0);
-	gfx.PutPixel(111 + x, 59 + y, 16, 175, 15);
-	gfx.PutPixel(112 + x, 59 + y, 223, 223, 0);
-	gfx.PutPixel(113 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(114 + x, 59 + y, 224, 224, 47);
-	gfx.PutPixel(115 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(116 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(117 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(118 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(119 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(120 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(121 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(122 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(123 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(124 + x, 59 + y, 16, 135, 15);
-	gfx.PutPixel(125 + x, 59 + y, 147, 105, 42);
-	gfx.PutPixel(126 + x, 59 + y, 143, 88, 48);
-	gfx.PutPixel(127 + x, 59 + y, 127, 72, 32);
-	gfx.PutPixel(128 + x, 59 + y, 79, 48, 0);
-	gfx.PutPixel(129 + x, 59 + y, 16, 144, 15);
-	gfx.PutPixel(130 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(131 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(132 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(133 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(134 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(135 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(136 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(137 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(138 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(139 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(140 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(141 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(142 + x, 59 + y, 16, 167, 15);
-	gfx.PutPixel(143 + x, 59 + y, 47, 63, 31);
-	gfx.PutPixel(104 + x, 60 + y, 47, 63, 31);
-	gfx.PutPixel(105 + x, 60 + y, 144, 144, 144);
-	gfx.PutPixel(106 + x, 60 + y, 224, 231, 224);
-	gfx.PutPixel(107 + x, 60 + y, 223, 223, 239);
-	gfx.PutPixel(108 + x, 60 + y, 207, 207, 224);
-	gfx.PutPixel(109 + x, 60 + y, 47, 63, 31);
-	gfx.PutPixel(110 + x, 60 + y, 0, 151, 0);
-	gfx.PutPixel(111 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(112 + x, 60 + y, 208, 215, 63);
-	gfx.PutPixel(113 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(114 + x, 60 + y, 223, 223, 0);
-	gfx.PutPixel(115 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(116 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(117 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(118 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(119 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(120 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(121 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(122 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(123 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(124 + x, 60 + y, 31, 119, 16);
-	gfx.PutPixel(125 + x, 60 + y, 143, 88, 48);
-	gfx.PutPixel(126 + x, 60 + y, 127, 72, 32);
-	gfx.PutPixel(127 + x, 60 + y, 102, 70, 33);
-	gfx.PutPixel(128 + x, 60 + y, 79, 48, 0);
-	gfx.PutPixel(129 + x, 60 + y, 16, 135, 15);
-	gfx.PutPixel(130 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(131 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(132 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(133 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(134 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(135 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(136 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(137 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(138 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(139 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(140 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(141 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(142 + x, 60 + y, 31, 143, 15);
-	gfx.PutPixel(143 + x, 60 + y, 47, 63, 31);
-	gfx.PutPixel(105 + x, 61 + y, 47, 63, 31);
-	gfx.PutPixel(106 + x, 61 + y, 144, 144, 144);
-	gfx.PutPixel(107 + x, 61 + y, 224, 231, 224);
-	gfx.PutPixel(108 + x, 61 + y, 223, 223, 239);
-	gfx.PutPixel(109 + x, 61 + y, 47, 63, 31);
-	gfx.PutPixel(110 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(111 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(112 + x, 61 + y, 175, 168, 32);
-	gfx.PutPixel(113 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(114 + x, 61 + y, 175, 168, 32);
-	gfx.PutPixel(115 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(116 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(117 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(118 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(119 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(120 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(121 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(122 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(123 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(124 + x, 61 + y, 32, 95, 16);
-	gfx.PutPixel(125 + x, 61 + y, 127, 72, 32);
-	gfx.PutPixel(126 + x, 61 + y, 111, 56, 31);
-	gfx.PutPixel(127 + x, 61 + y, 95, 63, 0);
-	gfx.PutPixel(128 + x, 61 + y, 79, 48, 0);
-	gfx.PutPixel(129 + x, 61 + y, 48, 111, 47);
-	gfx.PutPixel(130 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(131 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(132 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(133 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(134 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(135 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(136 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(137 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(138 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(139 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(140 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(141 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(142 + x, 61 + y, 31, 119, 16);
-	gfx.PutPixel(143 + x, 61 + y, 47, 63, 31);
-	gfx.PutPixel(106 + x, 62 + y, 47, 63, 31);
-	gfx.PutPixel(107 + x, 62 + y, 144, 144, 144);
-	gfx.PutPixel(108 + x, 62 + y, 224, 231, 224);
-	gfx.PutPixel(109 + x, 62 + y, 47, 63, 31);
-	gfx.PutPixel(110 + x, 62 + y, 48, 79, 0);
-	gfx.PutPixel(111 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(112 + x, 62 + y, 112, 112, 0);
-	gfx.PutPixel(113 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(114 + x, 62 + y, 112, 112, 0);
-	gfx.PutPixel(115 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(116 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(117 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(118 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(119 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(120 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(121 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(122 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(123 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(124 + x, 62 + y, 48, 79, 0);
-	gfx.PutPixel(125 + x, 62 + y, 111, 56, 31);
-	gfx.PutPixel(126 + x, 62 + y, 95, 63, 0);
-	gfx.PutPixel(127 + x, 62 + y, 79, 48, 0);
-	gfx.PutPixel(128 + x, 62 + y, 76, 46, 40);
-	gfx.PutPixel(129 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(130 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(131 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(132 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(133 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(134 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(135 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(136 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(137 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(138 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(139 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(140 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(141 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(142 + x, 62 + y, 32, 95, 16);
-	gfx.PutPixel(143 + x, 62 + y, 47, 63, 31);
-	gfx.PutPixel(107 + x, 63 + y, 32, 48, 31);
-	gfx.PutPixel(108 + x, 63 + y, 128, 135, 128);
-	gfx.PutPixel(109 + x, 63 + y, 47, 56, 31);
-	gfx.PutPixel(110 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(111 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(112 + x, 63 + y, 64, 71, 31);
-	gfx.PutPixel(113 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(114 + x, 63 + y, 64, 71, 31);
-	gfx.PutPixel(115 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(116 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(117 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(118 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(119 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(120 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(121 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(122 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(123 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(124 + x, 63 + y, 47, 56, 31);
-	gfx.PutPixel(125 + x, 63 + y, 78, 47, 59);
-	gfx.PutPixel(126 + x, 63 + y, 64, 40, 0);
-	gfx.PutPixel(127 + x, 63 + y, 64, 40, 0);
-	gfx.PutPixel(128 + x, 63 + y, 64, 40, 0);
-	gfx.PutPixel(129 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(130 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(131 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(132 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(133 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(134 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(135 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(136 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(137 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(138 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(139 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(140 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(141 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(142 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(143 + x, 63 + y, 47, 63, 31);
-	gfx.PutPixel(144 + x, 63 + y, 255, 163, 71);
-	gfx.PutPixel(108 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(109 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(110 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(111 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(112 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(113 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(114 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(115 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(116 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(117 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(118 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(119 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(120 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(121 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(122 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(123 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(124 + x, 64 + y, 15, 15, 15);
-	gfx.PutPixel(125 + x, 64 + y, 15, 15, 15);
-	gfx.PutPixel(126 + x, 64 + y, 15, 15, 15);
-	gfx.PutPixel(127 + x, 64 + y, 15, 15, 15);
-	gfx.PutPixel(128 + x, 64 + y, 15, 15, 15);
-	gfx.PutPixel(129 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(130 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(131 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(132 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(133 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(134 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(135 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(136 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(137 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(138 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(139 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(140 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(141 + x, 64 + y, 32, 48, 31);
-	gfx.PutPixel(142 + x, 64 + y, 47, 56, 31);
-	gfx.PutPixel(143 + x, 64 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 64 + y, 255, 163, 71);
-	gfx.PutPixel(113 + x, 65 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 65 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 65 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 65 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 65 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 65 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 65 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 65 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 65 + y, 255, 163, 71);
-	gfx.PutPixel(124 + x, 65 + y, 255, 163, 71);
-	gfx.PutPixel(125 + x, 65 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 65 + y, 255, 163, 71);
-	gfx.PutPixel(127 + x, 65 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 65 + y, 255, 163, 71);
-	gfx.PutPixel(131 + x, 65 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 65 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 65 + y, 255, 163, 71);
-	gfx.PutPixel(140 + x, 65 + y, 255, 163, 71);
-	gfx.PutPixel(141 + x, 65 + y, 255, 163, 71);
-	gfx.PutPixel(142 + x, 65 + y, 255, 163, 71);
-	gfx.PutPixel(143 + x, 65 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 65 + y, 255, 163, 71);
-	gfx.PutPixel(145 + x, 65 + y, 255, 163, 71);
-	gfx.PutPixel(146 + x, 65 + y, 255, 163, 71);
-	gfx.PutPixel(113 + x, 66 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 66 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 66 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 66 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 66 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 66 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 66 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 66 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 66 + y, 255, 163, 71);
-	gfx.PutPixel(124 + x, 66 + y, 255, 163, 71);
-	gfx.PutPixel(125 + x, 66 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 66 + y, 255, 163, 71);
-	gfx.PutPixel(127 + x, 66 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 66 + y, 255, 163, 71);
-	gfx.PutPixel(131 + x, 66 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 66 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 66 + y, 255, 163, 71);
-	gfx.PutPixel(140 + x, 66 + y, 255, 163, 71);
-	gfx.PutPixel(141 + x, 66 + y, 255, 163, 71);
-	gfx.PutPixel(142 + x, 66 + y, 255, 163, 71);
-	gfx.PutPixel(143 + x, 66 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 66 + y, 255, 163, 71);
-	gfx.PutPixel(145 + x, 66 + y, 255, 163, 71);
-	gfx.PutPixel(146 + x, 66 + y, 255, 163, 71);
-	gfx.PutPixel(111 + x, 67 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 67 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 67 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 67 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 67 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 67 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 67 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 67 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 67 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 67 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 67 + y, 255, 163, 71);
-	gfx.PutPixel(124 + x, 67 + y, 255, 163, 71);
-	gfx.PutPixel(125 + x, 67 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 67 + y, 255, 163, 71);
-	gfx.PutPixel(127 + x, 67 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 67 + y, 255, 163, 71);
-	gfx.PutPixel(131 + x, 67 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 67 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 67 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 67 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 67 + y, 255, 163, 71);
-	gfx.PutPixel(140 + x, 67 + y, 255, 163, 71);
-	gfx.PutPixel(141 + x, 67 + y, 255, 163, 71);
-	gfx.PutPixel(142 + x, 67 + y, 255, 163, 71);
-	gfx.PutPixel(143 + x, 67 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 67 + y, 255, 163, 71);
-	gfx.PutPixel(145 + x, 67 + y, 255, 163, 71);
-	gfx.PutPixel(146 + x, 67 + y, 255, 163, 71);
-	gfx.PutPixel(111 + x, 68 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 68 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 68 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 68 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 68 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 68 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 68 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 68 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 68 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 68 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 68 + y, 255, 163, 71);
-	gfx.PutPixel(124 + x, 68 + y, 255, 163, 71);
-	gfx.PutPixel(125 + x, 68 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 68 + y, 255, 163, 71);
-	gfx.PutPixel(127 + x, 68 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 68 + y, 255, 163, 71);
-	gfx.PutPixel(131 + x, 68 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 68 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 68 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 68 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 68 + y, 255, 163, 71);
-	gfx.PutPixel(140 + x, 68 + y, 255, 163, 71);
-	gfx.PutPixel(141 + x, 68 + y, 255, 163, 71);
-	gfx.PutPixel(142 + x, 68 + y, 255, 163, 71);
-	gfx.PutPixel(143 + x, 68 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 68 + y, 255, 163, 71);
-	gfx.PutPixel(145 + x, 68 + y, 255, 163, 71);
-	gfx.PutPixel(146 + x, 68 + y, 255, 163, 71);
-	gfx.PutPixel(111 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 69 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 69 + y, 255, 163, 71);
-	gfx.PutPixel(127 + x, 69 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 69 + y, 255, 163, 71);
-	gfx.PutPixel(131 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 69 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 69 + y, 255, 163, 71);
-	gfx.PutPixel(140 + x, 69 + y, 255, 163, 71);
-	gfx.PutPixel(141 + x, 69 + y, 255, 163, 71);
-	gfx.PutPixel(142 + x, 69 + y, 255, 163, 71);
-	gfx.PutPixel(143 + x, 69 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 69 + y, 255, 163, 71);
-	gfx.PutPixel(145 + x, 69 + y, 255, 163, 71);
-	gfx.PutPixel(146 + x, 69 + y, 255, 163, 71);
-	gfx.PutPixel(111 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 70 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 70 + y, 255, 163, 71);
-	gfx.PutPixel(127 + x, 70 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 70 + y, 255, 163, 71);
-	gfx.PutPixel(131 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 70 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 70 + y, 255, 163, 71);
-	gfx.PutPixel(140 + x, 70 + y, 255, 163, 71);
-	gfx.PutPixel(141 + x, 70 + y, 255, 163, 71);
-	gfx.PutPixel(142 + x, 70 + y, 255, 163, 71);
-	gfx.PutPixel(143 + x, 70 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 70 + y, 255, 163, 71);
-	gfx.PutPixel(145 + x, 70 + y, 255, 163, 71);
-	gfx.PutPixel(146 + x, 70 + y, 255, 163, 71);
-	gfx.PutPixel(111 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 71 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 71 + y, 255, 163, 71);
-	gfx.PutPixel(129 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 71 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 71 + y, 255, 163, 71);
-	gfx.PutPixel(140 + x, 71 + y, 255, 163, 71);
-	gfx.PutPixel(141 + x, 71 + y, 255, 163, 71);
-	gfx.PutPixel(142 + x, 71 + y, 255, 163, 71);
-	gfx.PutPixel(143 + x, 71 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 71 + y, 255, 163, 71);
-	gfx.PutPixel(145 + x, 71 + y, 255, 163, 71);
-	gfx.PutPixel(146 + x, 71 + y, 255, 163, 71);
-	gfx.PutPixel(111 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 72 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 72 + y, 255, 163, 71);
-	gfx.PutPixel(129 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 72 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 72 + y, 255, 163, 71);
-	gfx.PutPixel(140 + x, 72 + y, 255, 163, 71);
-	gfx.PutPixel(141 + x, 72 + y, 255, 163, 71);
-	gfx.PutPixel(142 + x, 72 + y, 255, 163, 71);
-	gfx.PutPixel(143 + x, 72 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 72 + y, 255, 163, 71);
-	gfx.PutPixel(145 + x, 72 + y, 255, 163, 71);
-	gfx.PutPixel(146 + x, 72 + y, 255, 163, 71);
-	gfx.PutPixel(111 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 73 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 73 + y, 255, 163, 71);
-	gfx.PutPixel(142 + x, 73 + y, 255, 163, 71);
-	gfx.PutPixel(143 + x, 73 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 73 + y, 255, 163, 71);
-	gfx.PutPixel(145 + x, 73 + y, 255, 163, 71);
-	gfx.PutPixel(146 + x, 73 + y, 255, 163, 71);
-	gfx.PutPixel(111 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 74 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 74 + y, 255, 163, 71);
-	gfx.PutPixel(142 + x, 74 + y, 255, 163, 71);
-	gfx.PutPixel(143 + x, 74 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 74 + y, 255, 163, 71);
-	gfx.PutPixel(145 + x, 74 + y, 255, 163, 71);
-	gfx.PutPixel(146 + x, 74 + y, 255, 163, 71);
-	gfx.PutPixel(109 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 75 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 75 + y, 255, 163, 71);
-	gfx.PutPixel(129 + x, 75 + y, 255, 163, 71);
-	gfx.PutPixel(130 + x, 75 + y, 255, 163, 71);
-	gfx.PutPixel(131 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 75 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 75 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 75 + y, 255, 163, 71);
-	gfx.PutPixel(109 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 76 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 76 + y, 255, 163, 71);
-	gfx.PutPixel(129 + x, 76 + y, 255, 163, 71);
-	gfx.PutPixel(130 + x, 76 + y, 255, 163, 71);
-	gfx.PutPixel(131 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 76 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 76 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 76 + y, 255, 163, 71);
-	gfx.PutPixel(107 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 77 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 77 + y, 255, 163, 71);
-	gfx.PutPixel(127 + x, 77 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 77 + y, 255, 163, 71);
-	gfx.PutPixel(129 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 77 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 78 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 78 + y, 255, 163, 71);
-	gfx.PutPixel(127 + x, 78 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 78 + y, 255, 163, 71);
-	gfx.PutPixel(129 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 78 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 79 + y, 255, 163, 71);
-	gfx.PutPixel(124 + x, 79 + y, 255, 163, 71);
-	gfx.PutPixel(125 + x, 79 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 79 + y, 255, 163, 71);
-	gfx.PutPixel(127 + x, 79 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 79 + y, 255, 163, 71);
-	gfx.PutPixel(129 + x, 79 + y, 255, 163, 71);
-	gfx.PutPixel(130 + x, 79 + y, 255, 163, 71);
-	gfx.PutPixel(131 + x, 79 + y, 255, 163, 71);
-	gfx.PutPixel(132 + x, 79 + y, 255, 163, 71);
-	gfx.PutPixel(133 + x, 79 + y, 255, 163, 71);
-	gfx.PutPixel(134 + x, 79 + y, 255, 163, 71);
-	gfx.PutPixel(137 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 79 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 80 + y, 255, 163, 71);
-	gfx.PutPixel(124 + x, 80 + y, 255, 163, 71);
-	gfx.PutPixel(125 + x, 80 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 80 + y, 255, 163, 71);
-	gfx.PutPixel(127 + x, 80 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 80 + y, 255, 163, 71);
-	gfx.PutPixel(129 + x, 80 + y, 255, 163, 71);
-	gfx.PutPixel(130 + x, 80 + y, 255, 163, 71);
-	gfx.PutPixel(131 + x, 80 + y, 255, 163, 71);
-	gfx.PutPixel(132 + x, 80 + y, 255, 163, 71);
-	gfx.PutPixel(133 + x, 80 + y, 255, 163, 71);
-	gfx.PutPixel(134 + x, 80 + y, 255, 163, 71);
-	gfx.PutPixel(137 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 80 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 81 + y, 255, 163, 71);
-	gfx.PutPixel(124 + x, 81 + y, 255, 163, 71);
-	gfx.PutPixel(125 + x, 81 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 81 + y, 255, 163, 71);
-	gfx.PutPixel(127 + x, 81 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 81 + y, 255, 163, 71);
-	gfx.PutPixel(129 + x, 81 + y, 255, 163, 71);
-	gfx.PutPixel(130 + x, 81 + y, 255, 163, 71);
-	gfx.PutPixel(131 + x, 81 + y, 255, 163, 71);
-	gfx.PutPixel(132 + x, 81 + y, 255, 163, 71);
-	gfx.PutPixel(133 + x, 81 + y, 255, 163, 71);
-	gfx.PutPixel(134 + x, 81 + y, 255, 163, 71);
-	gfx.PutPixel(137 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 81 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 82 + y, 255, 163, 71);
-	gfx.PutPixel(124 + x, 82 + y, 255, 163, 71);
-	gfx.PutPixel(125 + x, 82 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 82 + y, 255, 163, 71);
-	gfx.PutPixel(127 + x, 82 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 82 + y, 255, 163, 71);
-	gfx.PutPixel(129 + x, 82 + y, 255, 163, 71);
-	gfx.PutPixel(130 + x, 82 + y, 255, 163, 71);
-	gfx.PutPixel(131 + x, 82 + y, 255, 163, 71);
-	gfx.PutPixel(132 + x, 82 + y, 255, 163, 71);
-	gfx.PutPixel(133 + x, 82 + y, 255, 163, 71);
-	gfx.PutPixel(134 + x, 82 + y, 255, 163, 71);
-	gfx.PutPixel(137 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 82 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 83 + y, 255, 163, 71);
-	gfx.PutPixel(124 + x, 83 + y, 255, 163, 71);
-	gfx.PutPixel(125 + x, 83 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 83 + y, 255, 163, 71);
-	gfx.PutPixel(127 + x, 83 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 83 + y, 255, 163, 71);
-	gfx.PutPixel(129 + x, 83 + y, 255, 163, 71);
-	gfx.PutPixel(130 + x, 83 + y, 255, 163, 71);
-	gfx.PutPixel(131 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 83 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 84 + y, 255, 163, 71);
-	gfx.PutPixel(124 + x, 84 + y, 255, 163, 71);
-	gfx.PutPixel(125 + x, 84 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 84 + y, 255, 163, 71);
-	gfx.PutPixel(127 + x, 84 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 84 + y, 255, 163, 71);
-	gfx.PutPixel(129 + x, 84 + y, 255, 163, 71);
-	gfx.PutPixel(130 + x, 84 + y, 255, 163, 71);
-	gfx.PutPixel(131 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 84 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 85 + y, 255, 163, 71);
-	gfx.PutPixel(124 + x, 85 + y, 255, 163, 71);
-	gfx.PutPixel(125 + x, 85 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 85 + y, 255, 163, 71);
-	gfx.PutPixel(127 + x, 85 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 85 + y, 255, 163, 71);
-	gfx.PutPixel(129 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 85 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 86 + y, 255, 163, 71);
-	gfx.PutPixel(124 + x, 86 + y, 255, 163, 71);
-	gfx.PutPixel(125 + x, 86 + y, 255, 163, 71);
-	gfx.PutPixel(126 + x, 86 + y, 255, 163, 71);
-	gfx.PutPixel(127 + x, 86 + y, 255, 163, 71);
-	gfx.PutPixel(128 + x, 86 + y, 255, 163, 71);
-	gfx.PutPixel(129 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 86 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 87 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 88 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 91 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 92 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 93 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 94 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 95 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 96 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 97 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 98 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 99 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 100 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 101 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 102 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 103 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 103 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 103 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 103 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 103 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 103 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 103 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 103 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 103 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 103 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 103 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 103 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 104 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 104 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 104 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 104 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 104 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 104 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 104 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 104 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 104 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 104 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 104 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 104 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 105 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 106 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 107 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 108 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 109 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 110 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 111 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 112 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 113 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(119 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(120 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 114 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(106 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 115 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(106 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(117 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(118 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 116 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(106 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 117 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(106 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 118 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(106 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 119 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(106 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 120 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(106 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 121 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(106 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 122 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(106 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 123 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(106 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 124 + y, 255, 255, 255);
-	gfx.PutPixel(99 + x, 125 + y, 255, 163, 71);
-	gfx.PutPixel(100 + x, 125 + y, 255, 163, 71);
-	gfx.PutPixel(101 + x, 125 + y, 255, 163, 71);
-	gfx.PutPixel(102 + x, 125 + y, 255, 163, 71);
-	gfx.PutPixel(103 + x, 125 + y, 255, 163, 71);
-	gfx.PutPixel(104 + x, 125 + y, 255, 163, 71);
-	gfx.PutPixel(105 + x, 125 + y, 255, 255, 255);
-	gfx.PutPixel(106 + x, 125 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 125 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 125 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 125 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 125 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 125 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 125 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 125 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 125 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 125 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 125 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 125 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 125 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 125 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 125 + y, 255, 255, 255);
-	gfx.PutPixel(99 + x, 126 + y, 255, 163, 71);
-	gfx.PutPixel(100 + x, 126 + y, 255, 163, 71);
-	gfx.PutPixel(101 + x, 126 + y, 255, 163, 71);
-	gfx.PutPixel(102 + x, 126 + y, 255, 163, 71);
-	gfx.PutPixel(103 + x, 126 + y, 255, 163, 71);
-	gfx.PutPixel(104 + x, 126 + y, 255, 163, 71);
-	gfx.PutPixel(105 + x, 126 + y, 255, 255, 255);
-	gfx.PutPixel(106 + x, 126 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 126 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 126 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 126 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 126 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 126 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 126 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 126 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 126 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 126 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 126 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 126 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 126 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 126 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 126 + y, 255, 255, 255);
-	gfx.PutPixel(99 + x, 127 + y, 255, 163, 71);
-	gfx.PutPixel(100 + x, 127 + y, 255, 163, 71);
-	gfx.PutPixel(101 + x, 127 + y, 255, 163, 71);
-	gfx.PutPixel(102 + x, 127 + y, 255, 163, 71);
-	gfx.PutPixel(103 + x, 127 + y, 255, 163, 71);
-	gfx.PutPixel(104 + x, 127 + y, 255, 163, 71);
-	gfx.PutPixel(105 + x, 127 + y, 255, 255, 255);
-	gfx.PutPixel(106 + x, 127 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 127 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 127 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 127 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 127 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 127 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 127 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 127 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 127 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 127 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 127 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 127 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 127 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 127 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 127 + y, 255, 255, 255);
-	gfx.PutPixel(99 + x, 128 + y, 255, 163, 71);
-	gfx.PutPixel(100 + x, 128 + y, 255, 163, 71);
-	gfx.PutPixel(101 + x, 128 + y, 255, 163, 71);
-	gfx.PutPixel(102 + x, 128 + y, 255, 163, 71);
-	gfx.PutPixel(103 + x, 128 + y, 255, 163, 71);
-	gfx.PutPixel(104 + x, 128 + y, 255, 163, 71);
-	gfx.PutPixel(105 + x, 128 + y, 255, 255, 255);
-	gfx.PutPixel(106 + x, 128 + y, 255, 255, 255);
-	gfx.PutPixel(107 + x, 128 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 128 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 128 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 128 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 128 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 128 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 128 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 128 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 128 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 128 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 128 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 128 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 128 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 128 + y, 255, 255, 255);
-	gfx.PutPixel(99 + x, 129 + y, 255, 163, 71);
-	gfx.PutPixel(100 + x, 129 + y, 255, 163, 71);
-	gfx.PutPixel(101 + x, 129 + y, 255, 163, 71);
-	gfx.PutPixel(102 + x, 129 + y, 255, 163, 71);
-	gfx.PutPixel(103 + x, 129 + y, 255, 163, 71);
-	gfx.PutPixel(104 + x, 129 + y, 255, 163, 71);
-	gfx.PutPixel(105 + x, 129 + y, 255, 163, 71);
-	gfx.PutPixel(106 + x, 129 + y, 255, 163, 71);
-	gfx.PutPixel(107 + x, 129 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 129 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 129 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 129 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 129 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 129 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 129 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 129 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 129 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 129 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 129 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 129 + y, 255, 255, 255);
-	gfx.PutPixel(99 + x, 130 + y, 255, 163, 71);
-	gfx.PutPixel(100 + x, 130 + y, 255, 163, 71);
-	gfx.PutPixel(101 + x, 130 + y, 255, 163, 71);
-	gfx.PutPixel(102 + x, 130 + y, 255, 163, 71);
-	gfx.PutPixel(103 + x, 130 + y, 255, 163, 71);
-	gfx.PutPixel(104 + x, 130 + y, 255, 163, 71);
-	gfx.PutPixel(105 + x, 130 + y, 255, 163, 71);
-	gfx.PutPixel(106 + x, 130 + y, 255, 163, 71);
-	gfx.PutPixel(107 + x, 130 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 130 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 130 + y, 255, 255, 255);
-	gfx.PutPixel(136 + x, 130 + y, 255, 255, 255);
-	gfx.PutPixel(137 + x, 130 + y, 255, 255, 255);
-	gfx.PutPixel(138 + x, 130 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 130 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 130 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 130 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 130 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 130 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 130 + y, 255, 255, 255);
-	gfx.PutPixel(101 + x, 131 + y, 255, 163, 71);
-	gfx.PutPixel(102 + x, 131 + y, 255, 163, 71);
-	gfx.PutPixel(103 + x, 131 + y, 255, 163, 71);
-	gfx.PutPixel(104 + x, 131 + y, 255, 163, 71);
-	gfx.PutPixel(105 + x, 131 + y, 255, 163, 71);
-	gfx.PutPixel(106 + x, 131 + y, 255, 163, 71);
-	gfx.PutPixel(107 + x, 131 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 131 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 131 + y, 255, 163, 71);
-	gfx.PutPixel(136 + x, 131 + y, 255, 163, 71);
-	gfx.PutPixel(137 + x, 131 + y, 255, 163, 71);
-	gfx.PutPixel(138 + x, 131 + y, 255, 163, 71);
-	gfx.PutPixel(139 + x, 131 + y, 255, 163, 71);
-	gfx.PutPixel(140 + x, 131 + y, 255, 163, 71);
-	gfx.PutPixel(141 + x, 131 + y, 255, 163, 71);
-	gfx.PutPixel(142 + x, 131 + y, 255, 163, 71);
-	gfx.PutPixel(101 + x, 132 + y, 255, 163, 71);
-	gfx.PutPixel(102 + x, 132 + y, 255, 163, 71);
-	gfx.PutPixel(103 + x, 132 + y, 255, 163, 71);
-	gfx.PutPixel(104 + x, 132 + y, 255, 163, 71);
-	gfx.PutPixel(105 + x, 132 + y, 255, 163, 71);
-	gfx.PutPixel(106 + x, 132 + y, 255, 163, 71);
-	gfx.PutPixel(107 + x, 132 + y, 255, 255, 255);
-	gfx.PutPixel(108 + x, 132 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 132 + y, 255, 163, 71);
-	gfx.PutPixel(136 + x, 132 + y, 255, 163, 71);
-	gfx.PutPixel(137 + x, 132 + y, 255, 163, 71);
-	gfx.PutPixel(138 + x, 132 + y, 255, 163, 71);
-	gfx.PutPixel(139 + x, 132 + y, 255, 163, 71);
-	gfx.PutPixel(140 + x, 132 + y, 255, 163, 71);
-	gfx.PutPixel(141 + x, 132 + y, 255, 163, 71);
-	gfx.PutPixel(142 + x, 132 + y, 255, 163, 71);
-	gfx.PutPixel(101 + x, 133 + y, 255, 163, 71);
-	gfx.PutPixel(102 + x, 133 + y, 255, 163, 71);
-	gfx.PutPixel(103 + x, 133 + y, 255, 163, 71);
-	gfx.PutPixel(104 + x, 133 + y, 255, 163, 71);
-	gfx.PutPixel(105 + x, 133 + y, 255, 163, 71);
-	gfx.PutPixel(106 + x, 133 + y, 255, 163, 71);
-	gfx.PutPixel(135 + x, 133 + y, 255, 163, 71);
-	gfx.PutPixel(136 + x, 133 + y, 255, 163, 71);
-	gfx.PutPixel(137 + x, 133 + y, 255, 163, 71);
-	gfx.PutPixel(138 + x, 133 + y, 255, 163, 71);
-	gfx.PutPixel(139 + x, 133 + y, 255, 163, 71);
-	gfx.PutPixel(140 + x, 133 + y, 255, 163, 71);
-	gfx.PutPixel(141 + x, 133 + y, 255, 163, 71);
-	gfx.PutPixel(142 + x, 133 + y, 255, 163, 71);
-	gfx.PutPixel(143 + x, 133 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 133 + y, 255, 163, 71);
-	gfx.PutPixel(101 + x, 134 + y, 255, 163, 71);
-	gfx.PutPixel(102 + x, 134 + y, 255, 163, 71);
-	gfx.PutPixel(103 + x, 134 + y, 255, 163, 71);
-	gfx.PutPixel(104 + x, 134 + y, 255, 163, 71);
-	gfx.PutPixel(105 + x, 134 + y, 255, 163, 71);
-	gfx.PutPixel(106 + x, 134 + y, 255, 163, 71);
-	gfx.PutPixel(135 + x, 134 + y, 255, 163, 71);
-	gfx.PutPixel(136 + x, 134 + y, 255, 163, 71);
-	gfx.PutPixel(137 + x, 134 + y, 255, 163, 71);
-	gfx.PutPixel(138 + x, 134 + y, 255, 163, 71);
-	gfx.PutPixel(139 + x, 134 + y, 255, 163, 71);
-	gfx.PutPixel(140 + x, 134 + y, 255, 163, 71);
-	gfx.PutPixel(141 + x, 134 + y, 255, 163, 71);
-	gfx.PutPixel(142 + x, 134 + y, 255, 163, 71);
-	gfx.PutPixel(143 + x, 134 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 134 + y, 255, 163, 71);
-	gfx.PutPixel(103 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(104 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(105 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(106 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(107 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(108 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(135 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(136 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(137 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(138 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(139 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(140 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(141 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(142 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(143 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(145 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(146 + x, 135 + y, 255, 163, 71);
-	gfx.PutPixel(103 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(104 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(105 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(106 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(107 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(108 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(135 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(136 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(137 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(138 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(139 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(140 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(141 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(142 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(143 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(144 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(145 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(146 + x, 136 + y, 255, 163, 71);
-	gfx.PutPixel(57 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(58 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(59 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(60 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(61 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(62 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(63 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(64 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(65 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(66 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(91 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(101 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(102 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(145 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(146 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(147 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(148 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(149 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(162 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(163 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(164 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(165 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(166 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(167 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(175 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(176 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(177 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(178 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(179 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(180 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(181 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(182 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(183 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(184 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(185 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(186 + x, 147 + y, 255, 255, 255);
-	gfx.PutPixel(57 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(58 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(59 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(60 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(61 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(62 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(63 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(64 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(65 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(66 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(91 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(101 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(102 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(109 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(139 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(145 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(146 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(147 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(148 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(149 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(162 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(163 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(164 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(165 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(166 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(167 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(175 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(176 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(177 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(178 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(179 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(180 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(181 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(182 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(183 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(184 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(185 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(186 + x, 148 + y, 255, 255, 255);
-	gfx.PutPixel(55 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(56 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(57 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(58 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(59 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(60 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(61 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(62 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(63 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(64 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(65 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(66 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(67 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(68 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(91 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(96 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(101 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(102 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(106 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(111 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(116 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(117 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(118 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(121 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(145 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(146 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(147 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(148 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(157 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(163 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(164 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(165 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(166 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(175 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(176 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(177 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(178 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(179 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(180 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(181 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(182 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(183 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(184 + x, 149 + y, 0, 0, 74);
-	gfx.PutPixel(185 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(186 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(187 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(188 + x, 149 + y, 255, 255, 255);
-	gfx.PutPixel(55 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(56 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(57 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(58 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(59 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(60 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(61 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(62 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(63 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(64 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(65 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(66 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(67 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(68 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(91 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(96 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(101 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(102 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(106 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(111 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(116 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(117 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(118 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(121 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(145 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(146 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(147 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(148 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(157 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(163 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(164 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(165 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(166 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(175 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(176 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(177 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(178 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(179 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(180 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(181 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(182 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(183 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(184 + x, 150 + y, 0, 0, 74);
-	gfx.PutPixel(185 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(186 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(187 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(188 + x, 150 + y, 255, 255, 255);
-	gfx.PutPixel(55 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(56 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(57 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(58 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(59 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(60 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(65 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(66 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(67 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(68 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(69 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(70 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(91 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(96 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(101 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(102 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(106 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(111 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(116 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(121 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(153 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(157 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(175 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(176 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(177 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(178 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(179 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(180 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(185 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(186 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(187 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(188 + x, 151 + y, 255, 255, 255);
-	gfx.PutPixel(189 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(190 + x, 151 + y, 0, 0, 74);
-	gfx.PutPixel(55 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(56 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(57 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(58 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(59 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(60 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(65 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(66 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(67 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(68 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(69 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(70 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(91 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(96 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(101 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(102 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(106 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(111 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(116 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(121 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(153 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(157 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(175 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(176 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(177 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(178 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(179 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(180 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(185 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(186 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(187 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(188 + x, 152 + y, 255, 255, 255);
-	gfx.PutPixel(189 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(190 + x, 152 + y, 0, 0, 74);
-	gfx.PutPixel(55 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(56 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(57 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(58 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(59 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(60 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(61 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(62 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(63 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(64 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(65 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(66 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(67 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(68 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(69 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(70 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(91 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(96 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(97 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(98 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(101 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(102 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(106 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(111 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(116 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(121 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(126 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(127 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(145 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(146 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(147 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(148 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(149 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(152 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(153 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(157 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(162 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(163 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(164 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(165 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(166 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(167 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(175 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(176 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(177 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(178 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(179 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(180 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(181 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(182 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(183 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(184 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(185 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(186 + x, 153 + y, 255, 255, 255);
-	gfx.PutPixel(187 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(188 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(189 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(190 + x, 153 + y, 0, 0, 74);
-	gfx.PutPixel(55 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(56 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(57 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(58 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(59 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(60 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(61 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(62 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(63 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(64 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(65 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(66 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(67 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(68 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(69 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(70 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(91 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(96 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(97 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(98 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(101 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(102 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(106 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(111 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(116 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(121 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(126 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(127 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(145 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(146 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(147 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(148 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(149 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(152 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(153 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(157 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(162 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(163 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(164 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(165 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(166 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(167 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(175 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(176 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(177 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(178 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(179 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(180 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(181 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(182 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(183 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(184 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(185 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(186 + x, 154 + y, 255, 255, 255);
-	gfx.PutPixel(187 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(188 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(189 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(190 + x, 154 + y, 0, 0, 74);
-	gfx.PutPixel(55 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(56 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(57 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(58 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(59 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(60 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(61 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(62 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(63 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(64 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(65 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(66 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(67 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(68 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(69 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(70 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(91 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(96 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(97 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(98 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(99 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(100 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(101 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(102 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(106 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(111 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(116 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(121 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(126 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(129 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(145 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(146 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(147 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(148 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(157 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(163 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(164 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(165 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(166 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(175 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(176 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(177 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(178 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(179 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(180 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(181 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(182 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(183 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(184 + x, 155 + y, 0, 0, 74);
-	gfx.PutPixel(185 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(186 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(187 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(188 + x, 155 + y, 255, 255, 255);
-	gfx.PutPixel(55 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(56 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(57 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(58 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(59 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(60 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(61 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(62 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(63 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(64 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(65 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(66 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(67 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(68 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(69 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(70 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(91 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(96 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(97 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(98 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(99 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(100 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(101 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(102 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(106 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(111 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(116 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(121 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(126 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(129 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(145 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(146 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(147 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(148 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(157 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(163 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(164 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(165 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(166 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(175 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(176 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(177 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(178 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(179 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(180 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(181 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(182 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(183 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(184 + x, 156 + y, 0, 0, 74);
-	gfx.PutPixel(185 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(186 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(187 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(188 + x, 156 + y, 255, 255, 255);
-	gfx.PutPixel(55 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(56 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(57 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(58 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(59 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(60 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(65 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(66 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(67 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(68 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(69 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(70 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(91 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(96 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(97 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(98 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(99 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(100 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(101 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(102 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(106 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(111 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(116 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(121 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(126 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(131 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(153 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(157 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(175 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(176 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(177 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(178 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(179 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(180 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(185 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(186 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(187 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(188 + x, 157 + y, 255, 255, 255);
-	gfx.PutPixel(189 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(190 + x, 157 + y, 0, 0, 74);
-	gfx.PutPixel(55 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(56 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(57 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(58 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(59 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(60 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(65 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(66 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(67 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(68 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(69 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(70 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(91 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(96 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(97 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(98 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(99 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(100 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(101 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(102 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(106 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(111 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(116 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(121 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(126 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(131 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(153 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(157 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(175 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(176 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(177 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(178 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(179 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(180 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(185 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(186 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(187 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(188 + x, 158 + y, 255, 255, 255);
-	gfx.PutPixel(189 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(190 + x, 158 + y, 0, 0, 74);
-	gfx.PutPixel(55 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(56 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(57 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(58 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(59 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(60 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(65 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(66 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(67 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(68 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(69 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(70 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(91 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(96 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(97 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(98 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(101 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(102 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(106 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(109 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(126 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(131 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(153 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(157 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(175 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(176 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(177 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(178 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(179 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(180 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(185 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(186 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(187 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(188 + x, 159 + y, 255, 255, 255);
-	gfx.PutPixel(189 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(190 + x, 159 + y, 0, 0, 74);
-	gfx.PutPixel(55 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(56 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(57 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(58 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(59 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(60 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(65 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(66 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(67 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(68 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(69 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(70 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(91 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(96 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(97 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(98 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(101 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(102 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(103 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(104 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(105 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(106 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(109 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(110 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(111 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(112 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(113 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(114 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(115 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(116 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(126 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(131 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(153 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(157 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(175 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(176 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(177 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(178 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(179 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(180 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(185 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(186 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(187 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(188 + x, 160 + y, 255, 255, 255);
-	gfx.PutPixel(189 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(190 + x, 160 + y, 0, 0, 74);
-	gfx.PutPixel(57 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(58 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(59 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(60 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(67 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(68 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(69 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(70 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(93 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(94 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(95 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(96 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(103 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(104 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(105 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(106 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(111 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(112 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(113 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(114 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(115 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(116 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(117 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(118 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(123 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(124 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(125 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(126 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(133 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(134 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(135 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(141 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(142 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(143 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(151 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(152 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(153 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(159 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(160 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(161 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(169 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(170 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(171 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(177 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(178 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(179 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(180 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(187 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(188 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(189 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(190 + x, 161 + y, 0, 0, 74);
-	gfx.PutPixel(57 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(58 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(59 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(60 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(67 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(68 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(69 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(70 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(93 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(94 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(95 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(96 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(103 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(104 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(105 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(106 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(111 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(112 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(113 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(114 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(115 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(116 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(117 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(118 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(123 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(124 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(125 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(126 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(133 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(134 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(135 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(141 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(142 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(143 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(151 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(152 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(153 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(159 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(160 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(161 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(169 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(170 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(171 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(177 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(178 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(179 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(180 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(187 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(188 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(189 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(190 + x, 162 + y, 0, 0, 74);
-	gfx.PutPixel(73 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(74 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(75 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(76 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(77 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(78 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(79 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(80 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(87 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(88 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(89 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(90 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(91 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(96 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(145 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(146 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(147 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(148 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(149 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(157 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(167 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 167 + y, 255, 255, 255);
-	gfx.PutPixel(73 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(74 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(75 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(76 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(77 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(78 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(79 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(80 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(87 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(88 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(89 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(90 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(91 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(96 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(145 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(146 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(147 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(148 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(149 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(157 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(167 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 168 + y, 255, 255, 255);
-	gfx.PutPixel(75 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(76 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(77 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(78 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(79 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(80 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(81 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(82 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(85 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(86 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(87 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(88 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(89 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(90 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(91 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(92 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(93 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(94 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(95 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(96 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(97 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(98 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(126 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(131 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(145 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(146 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(147 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(148 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(157 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 169 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 169 + y, 0, 0, 74);
-	gfx.PutPixel(75 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(76 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(77 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(78 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(79 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(80 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(81 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(82 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(85 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(86 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(87 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(88 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(89 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(90 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(91 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(92 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(93 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(94 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(95 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(96 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(97 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(98 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(121 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(126 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(131 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(145 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(146 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(147 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(148 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(157 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 170 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 170 + y, 0, 0, 74);
-	gfx.PutPixel(75 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(76 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(77 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(78 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(79 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(80 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(85 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(86 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(87 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(88 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(89 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(90 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(97 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(98 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(99 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(100 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(121 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(126 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(131 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(153 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(157 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 171 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 171 + y, 0, 0, 74);
-	gfx.PutPixel(75 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(76 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(77 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(78 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(79 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(80 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(85 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(86 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(87 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(88 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(89 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(90 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(97 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(98 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(99 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(100 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(121 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(122 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(126 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(131 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(134 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(135 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(153 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(157 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 172 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 172 + y, 0, 0, 74);
-	gfx.PutPixel(75 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(76 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(77 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(78 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(79 + x, 173 + y, 0, 0, 74);
-	gfx.PutPixel(80 + x, 173 + y, 0, 0, 74);
-	gfx.PutPixel(87 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(88 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(89 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(90 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(91 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(96 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 173 + y, 0, 0, 74);
-	gfx.PutPixel(134 + x, 173 + y, 0, 0, 74);
-	gfx.PutPixel(135 + x, 173 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 173 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 173 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 173 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(153 + x, 173 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 173 + y, 0, 0, 74);
-	gfx.PutPixel(157 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 173 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 173 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 173 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 173 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 173 + y, 0, 0, 74);
-	gfx.PutPixel(75 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(76 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(77 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(78 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(79 + x, 174 + y, 0, 0, 74);
-	gfx.PutPixel(80 + x, 174 + y, 0, 0, 74);
-	gfx.PutPixel(87 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(88 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(89 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(90 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(91 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(96 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(123 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(124 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(132 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(133 + x, 174 + y, 0, 0, 74);
-	gfx.PutPixel(134 + x, 174 + y, 0, 0, 74);
-	gfx.PutPixel(135 + x, 174 + y, 0, 0, 74);
-	gfx.PutPixel(136 + x, 174 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 174 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 174 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(153 + x, 174 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 174 + y, 0, 0, 74);
-	gfx.PutPixel(157 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 174 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 174 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 174 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 174 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 174 + y, 0, 0, 74);
-	gfx.PutPixel(75 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(76 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(77 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(78 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(79 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(80 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(89 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(90 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(91 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(92 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(93 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(94 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(95 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(96 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(97 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(98 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(132 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(133 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(134 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(153 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(157 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 175 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 175 + y, 0, 0, 74);
-	gfx.PutPixel(75 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(76 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(77 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(78 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(79 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(80 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(89 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(90 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(91 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(92 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(93 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(94 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(95 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(96 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(97 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(98 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(125 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(132 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(133 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(134 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(153 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(157 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 176 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 176 + y, 0, 0, 74);
-	gfx.PutPixel(75 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(76 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(77 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(78 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(79 + x, 177 + y, 0, 0, 74);
-	gfx.PutPixel(80 + x, 177 + y, 0, 0, 74);
-	gfx.PutPixel(85 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(86 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(87 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(88 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(96 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(97 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(98 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(99 + x, 177 + y, 0, 0, 74);
-	gfx.PutPixel(100 + x, 177 + y, 0, 0, 74);
-	gfx.PutPixel(125 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 177 + y, 0, 0, 74);
-	gfx.PutPixel(132 + x, 177 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 177 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 177 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(153 + x, 177 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 177 + y, 0, 0, 74);
-	gfx.PutPixel(157 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 177 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 177 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 177 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 177 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 177 + y, 0, 0, 74);
-	gfx.PutPixel(75 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(76 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(77 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(78 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(79 + x, 178 + y, 0, 0, 74);
-	gfx.PutPixel(80 + x, 178 + y, 0, 0, 74);
-	gfx.PutPixel(85 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(86 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(87 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(88 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(96 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(97 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(98 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(99 + x, 178 + y, 0, 0, 74);
-	gfx.PutPixel(100 + x, 178 + y, 0, 0, 74);
-	gfx.PutPixel(125 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 178 + y, 0, 0, 74);
-	gfx.PutPixel(132 + x, 178 + y, 0, 0, 74);
-	gfx.PutPixel(139 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(140 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(141 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 178 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 178 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(152 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(153 + x, 178 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 178 + y, 0, 0, 74);
-	gfx.PutPixel(157 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(158 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(159 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 178 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 178 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(170 + x, 178 + y, 255, 255, 255);
-	gfx.PutPixel(171 + x, 178 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 178 + y, 0, 0, 74);
-	gfx.PutPixel(73 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(74 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(75 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(76 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(77 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(78 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(79 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(80 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(87 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(88 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(89 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(90 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(91 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(96 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(97 + x, 179 + y, 0, 0, 74);
-	gfx.PutPixel(98 + x, 179 + y, 0, 0, 74);
-	gfx.PutPixel(99 + x, 179 + y, 0, 0, 74);
-	gfx.PutPixel(100 + x, 179 + y, 0, 0, 74);
-	gfx.PutPixel(125 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 179 + y, 0, 0, 74);
-	gfx.PutPixel(132 + x, 179 + y, 0, 0, 74);
-	gfx.PutPixel(141 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(145 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(146 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(147 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(148 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(149 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 179 + y, 0, 0, 74);
-	gfx.PutPixel(152 + x, 179 + y, 0, 0, 74);
-	gfx.PutPixel(153 + x, 179 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 179 + y, 0, 0, 74);
-	gfx.PutPixel(159 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(162 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(163 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(164 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(165 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(166 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(167 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 179 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 179 + y, 0, 0, 74);
-	gfx.PutPixel(170 + x, 179 + y, 0, 0, 74);
-	gfx.PutPixel(171 + x, 179 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 179 + y, 0, 0, 74);
-	gfx.PutPixel(73 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(74 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(75 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(76 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(77 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(78 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(79 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(80 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(87 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(88 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(89 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(90 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(91 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(92 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(93 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(94 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(95 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(96 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(97 + x, 180 + y, 0, 0, 74);
-	gfx.PutPixel(98 + x, 180 + y, 0, 0, 74);
-	gfx.PutPixel(99 + x, 180 + y, 0, 0, 74);
-	gfx.PutPixel(100 + x, 180 + y, 0, 0, 74);
-	gfx.PutPixel(125 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(126 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(127 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(128 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(129 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(130 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(131 + x, 180 + y, 0, 0, 74);
-	gfx.PutPixel(132 + x, 180 + y, 0, 0, 74);
-	gfx.PutPixel(141 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(142 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(143 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(144 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(145 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(146 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(147 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(148 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(149 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(150 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(151 + x, 180 + y, 0, 0, 74);
-	gfx.PutPixel(152 + x, 180 + y, 0, 0, 74);
-	gfx.PutPixel(153 + x, 180 + y, 0, 0, 74);
-	gfx.PutPixel(154 + x, 180 + y, 0, 0, 74);
-	gfx.PutPixel(159 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(160 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(161 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(162 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(163 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(164 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(165 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(166 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(167 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(168 + x, 180 + y, 255, 255, 255);
-	gfx.PutPixel(169 + x, 180 + y, 0, 0, 74);
-	gfx.PutPixel(170 + x, 180 + y, 0, 0, 74);
-	gfx.PutPixel(171 + x, 180 + y, 0, 0, 74);
-	gfx.PutPixel(172 + x, 180 + y, 0, 0, 74);
-	gfx.PutPixel(75 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(76 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(77 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(78 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(79 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(80 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(81 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(82 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(89 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(90 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(91 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(92 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(93 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(94 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(95 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(96 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(97 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(98 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(127 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(128 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(129 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(130 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(131 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(132 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(143 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(145 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(146 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(147 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(148 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(150 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(151 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(152 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(161 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(163 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(164 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(165 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(166 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(168 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(169 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(170 + x, 181 + y, 0, 0, 74);
-	gfx.PutPixel(75 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(76 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(77 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(78 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(79 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(80 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(81 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(82 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(89 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(90 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(91 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(92 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(93 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(94 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(95 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(96 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(97 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(98 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(127 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(128 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(129 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(130 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(131 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(132 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(143 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(144 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(145 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(146 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(147 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(148 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(149 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(150 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(151 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(152 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(161 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(162 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(163 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(164 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(165 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(166 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(167 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(168 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(169 + x, 182 + y, 0, 0, 74);
-	gfx.PutPixel(170 + x, 182 + y, 0, 0, 74);
+	gfx.DrawSprite(x, y, GetSpanAtlas().win);
 }
@@ -0,0 +1,92 @@
+#include "TileCache.h"
+#include "SpriteAtlas.h"
+#include <assert.h>
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    void drawSprite(Color* tile, const SpriteAtlas::Sprite& sprite)
+    {
+        assert(sprite.width == TileCache::tileSize && sprite.height == TileCache::tileSize);
+        for (int y = 0; y < sprite.height; ++y)
+        {
+            const Color* row = SpriteAtlas::pixels + size_t(sprite.top + y) * SpriteAtlas::width + sprite.left;
+            for (int x = 0; x < sprite.width; ++x)
+            {
+                if (row[x].dword != SpriteAtlas::chroma.dword) tile[y * TileCache::tileSize + x] = row[x];
+            }
+        }
+    }
+}
+
+TileCache::TileCache(Color background)
+{
+    // COMPOSE THE LOOK OF EVERY KEY, KEEPING EACH DISTINCT ONE ONCE
+    std::vector<Color> distinctTiles;
+    std::vector<Color> tile(TILE_PIXELS);
+    for (int triggered = 0; triggered < 2; ++triggered)
+    {
+        for (int state = 0; state < 3; ++state)
+        {
+            for (int number = 0; number <= MINE; ++number)
+            {
+                std::fill(tile.begin(), tile.end(), background);
+                compose(tile.data(), State(state), number, triggered != 0);
+                int match = 0;
+                while (match < nTiles
+                    && memcmp(&distinctTiles[size_t(match) * TILE_PIXELS], tile.data(), TILE_PIXELS * sizeof(Color)) != 0)
+                {
+                    ++match;
+                }
+                if (match == nTiles)
+                {
+                    distinctTiles.insert(distinctTiles.end(), tile.begin(), tile.end());
+                    ++nTiles;
+                }
+                tileOfKey[getKey(State(state), number, triggered != 0)] = uint8_t(match);
+            }
+        }
+    }
+
+    storage.resize(distinctTiles.size() + ALIGNMENT / sizeof(Color) - 1);
+    const uintptr_t address = reinterpret_cast<uintptr_t>(storage.data());
+    tiles = storage.data() + ((ALIGNMENT - address % ALIGNMENT) % ALIGNMENT) / sizeof(Color);
+    std::copy(distinctTiles.begin(), distinctTiles.end(), tiles);
+}
+
+int TileCache::getNumberOfTiles() const
+{
+    return nTiles;
+}
+
+void TileCache::compose(Color* tile, State state, int number, bool isMineTriggered)
+{
+    const bool hasMine = number == MINE;
+    if (state == State::Revealed)
+    {
+        if (hasMine)
+        {
+            drawSprite(tile, isMineTriggered ? SpriteAtlas::tileBombRed : SpriteAtlas::tileBomb);
+        }
+        else {
+            drawSprite(tile, SpriteAtlas::tileNumbers[number]);
+        }
+    }
+    else if (state == State::Flagged)
+    {
+        if (isMineTriggered)
+        {
+            // A FLAG ON A MINE WAS RIGHT, ANY OTHER FLAG IS CROSSED OUT
+            drawSprite(tile, SpriteAtlas::tileBomb);
+            drawSprite(tile, hasMine ? SpriteAtlas::tileFlag : SpriteAtlas::tileCross);
+        }
+        else {
+            drawSprite(tile, SpriteAtlas::tileButton);
+            drawSprite(tile, SpriteAtlas::tileFlag);
+        }
+    }
+    else {
+        drawSprite(tile, isMineTriggered && hasMine ? SpriteAtlas::tileBomb : SpriteAtlas::tileButton);
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include "Colors.h"
+#include "SpriteCodex.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// EVERY LOOK A TILE CAN HAVE, COMPOSED ONCE FROM THE SPRITES OVER THE FIELD BACKGROUND. A LOOK IS KEYED BY THE
+// TILE'S STATE, ITS NUMBER (ITS ADJACENT MINE COUNT, OR MINE FOR A MINE) AND WHETHER A MINE WENT OFF; KEYS THAT
+// LOOK THE SAME SHARE ONE TILE, SO THE 15 DISTINCT LOOKS TAKE 15 KB. EVERY TILE IS AN OPAQUE tileSize x tileSize
+// BLOCK, 64-BYTE ALIGNED, SO DRAWING ONE IS A PLAIN COPY
+class TileCache
+{
+public:
+	static constexpr int tileSize = SpriteCodex::tileSize;
+	enum class State
+	{
+		Hidden,
+		Flagged,
+		Revealed
+	};
+	// THE NUMBER OF A TILE THAT IS A MINE; THE NUMBER OF ANY OTHER TILE ONLY MATTERS ONCE IT IS REVEALED
+	static constexpr int MINE = 9;
+public:
+	explicit TileCache(Color background);
+	TileCache(const TileCache&) = delete;
+	TileCache& operator=(const TileCache&) = delete;
+	// tileSize ROWS OF tileSize PIXELS
+	const Color* getTile(State state, int number, bool isMineTriggered) const
+	{
+		return tiles + size_t(tileOfKey[getKey(state, number, isMineTriggered)]) * TILE_PIXELS;
+	}
+	int getNumberOfTiles() const;
+private:
+	static int getKey(State state, int number, bool isMineTriggered)
+	{
+		return (int(isMineTriggered) * 3 + int(state)) * (MINE + 1) + number;
+	}
+	static void compose(Color* tile, State state, int number, bool isMineTriggered);
+private:
+	static constexpr int TILE_PIXELS = tileSize * tileSize;
+	static constexpr int N_KEYS = 2 * 3 * (MINE + 1);
+	static constexpr size_t ALIGNMENT = 64;
+private:
+	std::vector<Color> storage;
+	Color* tiles = nullptr;
+	int nTiles = 0;
+	uint8_t tileOfKey[N_KEYS];
+};
@@ -0,0 +1,72 @@
+#include "UndoHistory.h"
+#include <assert.h>
+
+UndoHistory::UndoHistory(Board& _board, size_t _memoryBudget)
+    :board(_board), memoryBudget(_memoryBudget)
+{
+}
+
+void UndoHistory::revealTile(const Vei2& gridPos)
+{
+    board.revealTile(gridPos, &pending);
+    push();
+}
+
+void UndoHistory::flagTile(const Vei2& gridPos)
+{
+    board.flagTile(gridPos, &pending);
+    push();
+}
+
+void UndoHistory::push()
+{
+    if (pending.isEmpty()) return;
+    while (deltas.size() > nApplied)
+    {
+        memoryUsed -= deltas.back().getMemoryFootprint();
+        deltas.pop_back();
+    }
+    pending.changes.shrink_to_fit();
+    memoryUsed += pending.getMemoryFootprint();
+    deltas.push_back(std::move(pending));
+    pending = Board::Delta();
+    ++nApplied;
+    // ALWAYS KEEP THE LATEST MOVE, EVEN WHEN IT ALONE IS OVER BUDGET
+    while (memoryUsed > memoryBudget && deltas.size() > 1)
+    {
+        memoryUsed -= deltas.front().getMemoryFootprint();
+        deltas.pop_front();
+        --nApplied;
+    }
+}
+
+bool UndoHistory::undo()
+{
+    if (!canUndo()) return false;
+    --nApplied;
+    board.revert(deltas[nApplied]);
+    return true;
+}
+
+bool UndoHistory::redo()
+{
+    if (!canRedo()) return false;
+    board.apply(deltas[nApplied]);
+    ++nApplied;
+    return true;
+}
+
+bool UndoHistory::canUndo() const
+{
+    return nApplied > 0;
+}
+
+bool UndoHistory::canRedo() const
+{
+    return nApplied < deltas.size();
+}
+
+size_t UndoHistory::getMemoryUsed() const
+{
+    return memoryUsed;
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include "Board.h"
+#include "Vei2.h"
+#include <deque>
+
+// UNDO AND REDO FOR THE MOVES MADE THROUGH IT ON A BOARD, KEPT AS DELTAS RATHER THAN BOARD COPIES. WHEN THE DELTAS
+// OUTGROW THE MEMORY BUDGET THE OLDEST MOVES STOP BEING UNDOABLE. A NEW MOVE DISCARDS THE MOVES THAT WERE UNDONE
+class UndoHistory
+{
+public:
+	UndoHistory(Board& _board, size_t _memoryBudget = 16 * 1024 * 1024);
+	void revealTile(const Vei2& gridPos);
+	void flagTile(const Vei2& gridPos);
+	bool undo();
+	bool redo();
+	bool canUndo() const;
+	bool canRedo() const;
+	size_t getMemoryUsed() const;
+private:
+	void push();
+private:
+	Board& board;
+	size_t memoryBudget;
+	// MOVES [0, nApplied) ARE ON THE BOARD, THE REST WERE UNDONE AND CAN BE REDONE
+	std::deque<Board::Delta> deltas;
+	size_t nApplied = 0;
+	size_t memoryUsed = 0;
+	// RECEIVES EACH MOVE BEFORE IT IS KNOWN TO CHANGE ANYTHING; ITS MEMORY IS REUSED FOR NO-OP MOVES
+	Board::Delta pending;
+};
@@ -0,0 +1,121 @@
+// HEADLESS BATCH SIMULATOR: PLAYS GAMES WITH A STRATEGY AND REPORTS THROUGHPUT, WIN RATE AND MOVE LATENCY,
+// AND WITH --no-guess, HOW FAST NO-GUESS BOARDS OF THE SAME SIZE ARE GENERATED.
+// IT ONLY USES THE WINDOW-FREE PART OF THE ENGINE, SO IT BUILDS ON LINUX WITH:
+//   g++ -O2 -std=c++17 -pthread -I../Engine Main.cpp ../Engine/GameFarm.cpp ../Engine/Simulation.cpp
+//       ../Engine/ProbabilityEngine.cpp ../Engine/Solver.cpp ../Engine/Board.cpp ../Engine/AdjacencyCount.cpp
+//       ../Engine/Vei2.cpp ../Engine/RectI.cpp ../Engine/NoGuessGenerator.cpp -o simulator
+// EXAMPLE: ./simulator --games 100000 --strategy solver --width 30 --height 16 --mines 99 --threads 8
+#include "GameFarm.h"
+#include "NoGuessGenerator.h"
+#include "SplitMix64.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace
+{
+    void printUsage()
+    {
+        std::fprintf(stderr,
+            "usage: simulator [--games N] [--strategy random|solver] [--width W] [--height H]\n"
+            "                 [--mines M | --density D] [--seed S] [--threads T] [--no-guess BOARDS]\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    long long nGames = 1000;
+    Strategy strategy = Strategy::Solver;
+    int width = 30;
+    int height = 16;
+    int nMines = 99;
+    double density = 0.0;
+    uint64_t seed = 1;
+    int nThreads = 0;
+    int nNoGuessBoards = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string option = argv[i];
+        if (i + 1 >= argc)
+        {
+            printUsage();
+            return 1;
+        }
+        const char* value = argv[++i];
+        if (option == "--games") nGames = std::atoll(value);
+        else if (option == "--width") width = std::atoi(value);
+        else if (option == "--height") height = std::atoi(value);
+        else if (option == "--mines") nMines = std::atoi(value);
+        else if (option == "--density") density = std::atof(value);
+        else if (option == "--seed") seed = std::strtoull(value, nullptr, 0);
+        else if (option == "--threads") nThreads = std::atoi(value);
+        else if (option == "--no-guess") nNoGuessBoards = std::atoi(value);
+        else if (option == "--strategy" && std::strcmp(value, "random") == 0) strategy = Strategy::Random;
+        else if (option == "--strategy" && std::strcmp(value, "solver") == 0) strategy = Strategy::Solver;
+        else {
+            printUsage();
+            return 1;
+        }
+    }
+    if (density > 0.0)
+    {
+        nMines = int(density * width * height + 0.5);
+    }
+    if (nGames <= 0 || width <= 0 || height <= 0 || nMines <= 0 || nMines >= width * height
+        || nThreads < 0 || nGames > 0xFFFFFFFFll || nNoGuessBoards < 0)
+    {
+        printUsage();
+        return 1;
+    }
+
+    // GAME i PLACES ITS MINES FROM THE i-TH SEED OF THE STREAM, SO A RUN REPRODUCES FROM --seed ALONE,
+    // WHATEVER THE NUMBER OF THREADS
+    GameFarm farm(width, height, nMines, strategy, nThreads);
+    farm.run(seed, nGames);
+    const Simulation& simulation = farm.getResults();
+
+    const LatencyHistogram& latencies = simulation.getMoveLatencies();
+    std::printf("%lld games of %dx%d with %d mines, %s strategy, seed %llu\n", nGames, width, height, nMines,
+        strategy == Strategy::Random ? "random" : "solver", (unsigned long long)seed);
+    std::printf("games/sec:    %.1f on %d threads, %.1f per thread\n", farm.getGamesPerSecond(),
+        farm.getNumberOfThreads(), farm.getGamesPerSecond() / farm.getNumberOfThreads());
+    std::printf("win rate:     %.2f%%\n", 100.0 * simulation.getNumberOfWins() / nGames);
+    std::printf("moves/game:   %.1f\n", double(simulation.getNumberOfMoves()) / nGames);
+    std::printf("move latency: p50 %.0f ns, p99 %.0f ns\n", latencies.getPercentile(50.0),
+        latencies.getPercentile(99.0));
+    double lowestEfficiency = 1.0;
+    for (int i = 0; i < farm.getNumberOfThreads(); ++i)
+    {
+        lowestEfficiency = std::min(lowestEfficiency, farm.getWorkerEfficiency(i));
+    }
+    std::printf("efficiency:   %.1f%% per thread on average, %.1f%% lowest, %lld steals\n",
+        100.0 * farm.getEfficiency(), 100.0 * lowestEfficiency, farm.getNumberOfSteals());
+
+    if (nNoGuessBoards > 0)
+    {
+        // BOARD j SEARCHES FROM THE j-TH SEED OF THE STREAM, REVEALING THE CENTER TILE FIRST LIKE THE GAMES DO
+        const Vei2 firstRevealedPos(width / 2, height / 2);
+        long long nCandidates = 0;
+        double coreSeconds = 0.0;
+        int nFound = 0;
+        int nGeneratorThreads = 0;
+        for (int j = 0; j < nNoGuessBoards; ++j)
+        {
+            NoGuessGenerator generator(width, height, nMines, SplitMix64::at(seed, uint64_t(j)), nThreads);
+            nFound += generator.generate(firstRevealedPos) ? 1 : 0;
+            nCandidates += generator.getNumberOfCandidatesTried();
+            if (generator.getBoardsPerSecondPerCore() > 0.0)
+            {
+                coreSeconds += generator.getNumberOfCandidatesTried() / generator.getBoardsPerSecondPerCore();
+            }
+            nGeneratorThreads = generator.getNumberOfThreads();
+        }
+        std::printf("no-guess:     %d of %d boards found, %lld candidates tried (%.1f per board)\n", nFound,
+            nNoGuessBoards, nCandidates, double(nCandidates) / nNoGuessBoards);
+        std::printf("no-guess:     %.1f boards/sec per core on %d threads\n",
+            coreSeconds > 0.0 ? nCandidates / coreSeconds : 0.0, nGeneratorThreads);
+    }
+    return 0;
+}